@@ -10,6 +10,7 @@
 //#include "unitmanager.h"
 //#include "util/json.h"
 #include "asteriximporttask.h"
+#include "jsonmappingplan.h"
 #include "files.h"
 
 #include <QTableView>
@@ -313,6 +314,23 @@ bool ASTERIXJSONParser::parseJSON(nlohmann::json& j, Buffer& buffer) const
     return parsed_any;
 }
 
+bool ASTERIXJSONParser::parseJSON(nlohmann::json& j, const JSONMappingPlan& plan) const
+{
+    assert(initialized_);
+
+    logdbg << "ASTERIXJSONParser: parseJSON: single target report, mapping plan";
+    assert(j.is_object());
+
+    return plan.mapRecord(j, plan.buffer().size());
+}
+
+std::unique_ptr<JSONMappingPlan> ASTERIXJSONParser::createMappingPlan(Buffer& buffer) const
+{
+    assert(initialized_);
+
+    return std::unique_ptr<JSONMappingPlan>(new JSONMappingPlan(data_mappings_, buffer));
+}
+
 void ASTERIXJSONParser::createMappingStubs(nlohmann::json& j)
 {
     assert(initialized_);
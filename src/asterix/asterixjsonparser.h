@@ -16,6 +16,7 @@
 class DBContent;
 class Buffer;
 class ASTERIXImportTask;
+class JSONMappingPlan;
 
 class ASTERIXJSONParser : public QAbstractItemModel, public Configurable
 {
@@ -45,6 +46,9 @@ public:
 
     // returns true on successful parse
     bool parseJSON(nlohmann::json& j, Buffer& buffer) const;
+    // returns true on successful parse, uses pre-resolved buffer columns of plan
+    bool parseJSON(nlohmann::json& j, const JSONMappingPlan& plan) const;
+    std::unique_ptr<JSONMappingPlan> createMappingPlan(Buffer& buffer) const;
     void createMappingStubs(nlohmann::json& j);
 
     const dbContent::VariableSet& variableList() const;
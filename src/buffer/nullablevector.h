@@ -18,6 +18,7 @@
 #pragma once
 
 #include "buffer.h"
+#include "nullbitmap.h"
 #include "property.h"
 #include "stringconv.h"
 #include "json.hpp"
@@ -86,6 +87,20 @@ public:
     void setNull(unsigned int index);
     void setAllNull();
 
+    // bulk operations, set num_values values starting at from_index
+    void setRange(unsigned int from_index, const T* values, size_t num_values);
+    void setNullRange(unsigned int from_index, size_t num_values);
+    // sets null flags from a validity mask (set bit = valid, as in DuckDB/Arrow), starting at
+    // bit mask_offset in the mask, stored data of null values is reset to T()
+    void setNullFromValidityMask(unsigned int from_index, const uint64_t* valid_mask, size_t mask_offset,
+                                 size_t num_values);
+
+    // copies num_values values starting at from_index, not set values are copied as T()
+    void getRange(unsigned int from_index, T* values, size_t num_values) const;
+    // writes validity mask (set bit = valid) for num_values values starting at from_index, returns
+    // number of null values
+    size_t getValidityMask(unsigned int from_index, uint64_t* valid_mask, size_t num_values) const;
+
     NullableVector<T>& operator*=(double factor);
 
     std::set<T> distinctValues(unsigned int index = 0);
@@ -105,6 +120,7 @@ public:
     void convertToStandardFormat(const std::string& from_format);
 
     unsigned int contentSize();
+    unsigned int nullCount() const; // number of null values up to buffer size
 
     /// @brief Checks if specific element is Null
     bool isNull(unsigned int index) const;
@@ -134,7 +150,7 @@ private:
 
     std::vector<T> data_;
 
-    std::vector<bool> null_flags_;
+    NullBitmap null_flags_;
 
     void unsetNull(unsigned int index);
 
@@ -160,7 +176,7 @@ void NullableVector<T>::clear()
 {
     logdbg << "NullableVector " << property_.name() << ": clear";
     std::fill(data_.begin(), data_.end(), T());
-    std::fill(null_flags_.begin(), null_flags_.end(), true);
+    null_flags_.setAll(true);
 }
 
 template <class T>
@@ -374,7 +390,7 @@ void NullableVector<T>::setNull(unsigned int index)
     if (BUFFER_PEDANTIC_CHECKING)
         assert(index < null_flags_.size());
 
-    null_flags_.at(index) = true;
+    null_flags_.set(index, true);
 }
 
 template <class T>
@@ -382,12 +398,154 @@ void NullableVector<T>::setAllNull()
 {
     unsigned int data_size = data_.size();
 
-    for (unsigned int cnt=0; cnt < data_size; ++cnt)
-        setNull(cnt);
+    if (!data_size)
+        return;
+
+    if (null_flags_.size() < data_size)
+        resizeNullTo(data_size);
+
+    null_flags_.setRange(0, data_size, true);
+}
+
+template <class T>
+void NullableVector<T>::setRange(unsigned int from_index, const T* values, size_t num_values)
+{
+    logdbg << "NullableVector " << property_.name() << ": setRange: from_index " << from_index
+           << " num_values " << num_values;
+
+    if (!num_values)
+        return;
+
+    unsigned int to_index = from_index + num_values; // exclusive
+
+    if (to_index > data_.size())
+    {
+        if (from_index > data_.size() && to_index > null_flags_.size())  // some where left out
+            resizeNullTo(to_index);
+
+        resizeDataTo(to_index);
+    }
+
+    std::copy(values, values + num_values, data_.begin() + from_index);
+
+    if (from_index < null_flags_.size()) // unset stored nulls
+        null_flags_.setRange(from_index, std::min<size_t>(to_index, null_flags_.size()), false);
+}
+
+template <class T>
+void NullableVector<T>::setNullRange(unsigned int from_index, size_t num_values)
+{
+    logdbg << "NullableVector " << property_.name() << ": setNullRange: from_index " << from_index
+           << " num_values " << num_values;
+
+    if (!num_values)
+        return;
+
+    unsigned int to_index = from_index + num_values; // exclusive
+
+    if (to_index > null_flags_.size())
+        resizeNullTo(to_index);
+
+    null_flags_.setRange(from_index, to_index, true);
 }
 
 
 /// @brief Checks if specific element is Null
+template <class T>
+void NullableVector<T>::setNullFromValidityMask(unsigned int from_index, const uint64_t* valid_mask,
+                                                size_t mask_offset, size_t num_values)
+{
+    logdbg << "NullableVector " << property_.name() << ": setNullFromValidityMask: from_index " << from_index
+           << " num_values " << num_values;
+
+    if (!num_values)
+        return;
+
+    unsigned int to_index = from_index + num_values; // exclusive
+
+    if (to_index > null_flags_.size())
+        resizeNullTo(to_index);
+
+    for (size_t cnt = 0; cnt < num_values; cnt += NullBitmap::WordBits)
+    {
+        size_t num_bits = num_values - cnt;
+
+        if (num_bits > NullBitmap::WordBits)
+            num_bits = NullBitmap::WordBits;
+
+        NullBitmap::Word null_bits = ~NullBitmap::readBits(valid_mask, mask_offset + cnt, num_bits);
+
+        if (num_bits < NullBitmap::WordBits)
+            null_bits &= (((NullBitmap::Word)1) << num_bits) - 1;
+
+        null_flags_.assignBits(from_index + cnt, null_bits, num_bits);
+
+        // do not keep arbitrary data in null slots
+        for (size_t b = 0; null_bits; ++b, null_bits >>= 1)
+        {
+            if ((null_bits & 1) && from_index + cnt + b < data_.size())
+                data_[ from_index + cnt + b ] = T();
+        }
+    }
+}
+
+template <class T>
+void NullableVector<T>::getRange(unsigned int from_index, T* values, size_t num_values) const
+{
+    logdbg << "NullableVector " << property_.name() << ": getRange: from_index " << from_index
+           << " num_values " << num_values;
+
+    size_t num_set = from_index < data_.size() ? std::min<size_t>(num_values, data_.size() - from_index) : 0;
+
+    if (num_set)
+        std::copy(data_.begin() + from_index, data_.begin() + from_index + num_set, values);
+
+    std::fill(values + num_set, values + num_values, T());
+}
+
+template <class T>
+size_t NullableVector<T>::getValidityMask(unsigned int from_index, uint64_t* valid_mask,
+                                          size_t num_values) const
+{
+    logdbg << "NullableVector " << property_.name() << ": getValidityMask: from_index " << from_index
+           << " num_values " << num_values;
+
+    size_t num_null = 0;
+
+    // not stored ones are null if not set
+    size_t not_stored_from = std::max(null_flags_.size(), data_.size());
+
+    for (size_t cnt = 0; cnt < num_values; cnt += NullBitmap::WordBits)
+    {
+        size_t num_bits = num_values - cnt;
+
+        if (num_bits > NullBitmap::WordBits)
+            num_bits = NullBitmap::WordBits;
+
+        size_t index = from_index + cnt;
+        NullBitmap::Word null_bits = 0;
+
+        if (index < null_flags_.size())
+            null_bits = null_flags_.bits(index, std::min<size_t>(num_bits, null_flags_.size() - index));
+
+        if (index + num_bits > not_stored_from)
+        {
+            size_t first_bit = not_stored_from > index ? not_stored_from - index : 0;
+            NullBitmap::Word mask = ~NullBitmap::Word(0) << first_bit;
+
+            if (num_bits < NullBitmap::WordBits)
+                mask &= (NullBitmap::Word(1) << num_bits) - 1;
+
+            null_bits |= mask;
+        }
+
+        valid_mask[cnt / NullBitmap::WordBits] = ~null_bits;
+        num_null += __builtin_popcountll(null_bits);
+    }
+
+    return num_null;
+}
+
 template <class T>
 bool NullableVector<T>::isNull(unsigned int index) const
 {
@@ -401,7 +559,7 @@ bool NullableVector<T>::isNull(unsigned int index) const
     }
 
     if (index < null_flags_.size())  // if stored, return value
-        return null_flags_.at(index);
+        return null_flags_.test(index);
 
     // null not stored, so all set are not null
 
@@ -471,7 +629,7 @@ void NullableVector<T>::addData(NullableVector<T>& other)
                << ": addData: 1: other no data resizing null";
         resizeNullTo(buffer_.size_);
         logdbg << "NullableVector " << property_.name() << ": addData: 1: inserting null";
-        null_flags_.insert(null_flags_.end(), other.null_flags_.begin(), other.null_flags_.end());
+        null_flags_.append(other.null_flags_);
         return;
     }
 
@@ -502,7 +660,7 @@ void NullableVector<T>::addData(NullableVector<T>& other)
            << buffer_.size_;
     resizeNullTo(buffer_.size_);
     logdbg << "NullableVector " << property_.name() << ": addData: 3: inserting nulls";
-    null_flags_.insert(null_flags_.end(), other.null_flags_.begin(), other.null_flags_.end());
+    null_flags_.append(other.null_flags_);
 
     if (data_.size() < buffer_.size_)  // need to size data up
     {
@@ -880,16 +1038,16 @@ std::vector<unsigned int> NullableVector<T>::nullValueIndexes(unsigned int from_
     //    if (from_index+1 >= data_.size()) // no data
     //        return indexes;
 
-    for (unsigned int index = from_index; index <= to_index; ++index)
-    {
-        if (isNull(index))  // not for null
-        {
-            if (BUFFER_PEDANTIC_CHECKING)
-                assert(index < data_.size());
+    // stored null flags word-at-a-time
+    size_t stored_to_index = std::min<size_t>(to_index + 1, null_flags_.size()); // exclusive
 
-            indexes.push_back(index);
-        }
-    }
+    if (from_index < stored_to_index)
+        null_flags_.setIndexes(from_index, stored_to_index, indexes);
+
+    // not stored ones are null if not set
+    for (size_t index = std::max<size_t>(from_index, std::max(null_flags_.size(), data_.size()));
+         index <= to_index; ++index)
+        indexes.push_back(index);
 
     logdbg << "NullableVector " << property_.name() << ": nullValueIndexes: done with "
            << indexes.size();
@@ -975,6 +1133,21 @@ unsigned int NullableVector<T>::contentSize()
     return data_.size();
 }
 
+template <class T>
+unsigned int NullableVector<T>::nullCount() const
+{
+    size_t num_stored = std::min<size_t>(buffer_.size_, null_flags_.size());
+    size_t num_null = null_flags_.count(0, num_stored);
+
+    // not stored ones are null if not set
+    size_t not_stored_from = std::max(null_flags_.size(), data_.size());
+
+    if (buffer_.size_ > not_stored_from)
+        num_null += buffer_.size_ - not_stored_from;
+
+    return num_null;
+}
+
 template <class T>
 void NullableVector<T>::cutToSize(unsigned int size)
 {
@@ -986,11 +1159,11 @@ void NullableVector<T>::cutToSize(unsigned int size)
         assert(null_flags_.size() <= buffer_.size_);
     }
 
-    while (null_flags_.size() > size)
-        null_flags_.pop_back();
+    if (null_flags_.size() > size)
+        null_flags_.resize(size);
 
-    while (data_.size() > size)
-        data_.pop_back();
+    if (data_.size() > size)
+        data_.resize(size);
 
     // size set in Buffer::cutToSize
 }
@@ -1007,12 +1180,7 @@ void NullableVector<T>::cutUpToIndex(unsigned int index) // everything up to ind
     // Erase the range including both 0 and index
 
     if (null_flags_.size())
-    {
-        if (index < null_flags_.size() - 1)
-            null_flags_.erase(null_flags_.begin(), null_flags_.begin() + index + 1); // first and last, is correct
-        else
-            null_flags_.clear(); // would have been removed
-    }
+        null_flags_.eraseFront(index + 1); // first and last, is correct, cleared if all removed
 
     if (data_.size())
     {
@@ -1109,7 +1277,7 @@ void NullableVector<T>::removeIndexes(const std::vector<unsigned int>& indexes_t
             {
                 while (null_idx_old < idx_tbr)
                 {
-                    null_flags_[ null_idx_new ] = null_flags_[ null_idx_old ];
+                    null_flags_.set(null_idx_new, null_flags_.test(null_idx_old));
 
                     null_idx_new++;
                     null_idx_old++;
@@ -1124,7 +1292,7 @@ void NullableVector<T>::removeIndexes(const std::vector<unsigned int>& indexes_t
         //copy any null beyond last index to be removed
         while (null_idx_old < null_flags_.size())
         {
-            null_flags_[ null_idx_new ] = null_flags_[ null_idx_old ];
+            null_flags_.set(null_idx_new, null_flags_.test(null_idx_old));
 
             null_idx_new++;
             null_idx_old++;
@@ -1143,14 +1311,13 @@ bool NullableVector<T>::isAlwaysNull() const
     if (data_.size() == 0)
         return true;
 
+    // only set data can be not null
+    size_t num_set = std::min<size_t>(data_.size(), buffer_.size_);
 
-    for (unsigned int cnt = 0; cnt < buffer_.size_; cnt++)
-    {
-        if (!isNull(cnt))
-            return false;
-    }
+    if (num_set > null_flags_.size()) // set without stored null flags
+        return false;
 
-    return true;
+    return null_flags_.count(0, num_set) == num_set;
 }
 
 template <class T>
@@ -1158,13 +1325,11 @@ bool NullableVector<T>::isNeverNull() const
 {
     logdbg << "NullableVector " << property_.name() << ": isNeverNull";
 
-    for (unsigned int cnt = 0; cnt < buffer_.size_; cnt++)
-    {
-        if (isNull(cnt))
-            return false;
-    }
+    // neither set nor stored null flag
+    if (buffer_.size_ > std::max(data_.size(), null_flags_.size()))
+        return false;
 
-    return true;
+    return null_flags_.count(0, std::min<size_t>(buffer_.size_, null_flags_.size())) == 0;
 }
 
 template <class T>
@@ -1327,7 +1492,7 @@ void NullableVector<T>::unsetNull(unsigned int index)
     }
 
     if (index < null_flags_.size())  // if was already set
-        null_flags_.at(index) = false;
+        null_flags_.set(index, false);
 }
 
 template <>
@@ -0,0 +1,306 @@
+/*
+ * This file is part of OpenATS COMPASS.
+ *
+ * COMPASS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * COMPASS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with COMPASS. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Null flags of a NullableVector stored as bitmap in 64-bit words, a set bit marks a null value.
+ *
+ * Bits beyond size() inside the last word are always kept unset, so that counting and
+ * searching can operate on whole words.
+ */
+class NullBitmap
+{
+public:
+    typedef uint64_t Word;
+    static const size_t WordBits = 64;
+
+    NullBitmap() = default;
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    void clear()
+    {
+        words_.clear();
+        size_ = 0;
+    }
+
+    bool test(size_t index) const
+    {
+        assert (index < size_);
+        return (words_[index / WordBits] >> (index % WordBits)) & 1;
+    }
+
+    void set(size_t index, bool value)
+    {
+        assert (index < size_);
+
+        if (value)
+            words_[index / WordBits] |= bitMask(index);
+        else
+            words_[index / WordBits] &= ~bitMask(index);
+    }
+
+    // resizes to size, new bits are set to value
+    void resize(size_t size, bool value=false)
+    {
+        size_t old_size = size_;
+
+        words_.resize(numWords(size), 0);
+        size_ = size;
+
+        if (size > old_size && value)
+            setRange(old_size, size, true);
+        else if (size < old_size)
+            clearUnusedBits();
+    }
+
+    // sets bits in [from_index, to_index) to value, word-at-a-time
+    void setRange(size_t from_index, size_t to_index, bool value)
+    {
+        assert (from_index <= to_index);
+        assert (to_index <= size_);
+
+        if (from_index == to_index)
+            return;
+
+        size_t first_word = from_index / WordBits;
+        size_t last_word = (to_index - 1) / WordBits;
+
+        for (size_t word_cnt = first_word; word_cnt <= last_word; ++word_cnt)
+        {
+            Word mask = ~Word(0);
+
+            if (word_cnt == first_word)
+                mask &= ~Word(0) << (from_index % WordBits);
+
+            if (word_cnt == last_word && to_index % WordBits)
+                mask &= ~Word(0) >> (WordBits - to_index % WordBits);
+
+            if (value)
+                words_[word_cnt] |= mask;
+            else
+                words_[word_cnt] &= ~mask;
+        }
+    }
+
+    void setAll(bool value) { setRange(0, size_, value); }
+
+    // number of set bits in [from_index, to_index)
+    size_t count(size_t from_index, size_t to_index) const
+    {
+        assert (from_index <= to_index);
+        assert (to_index <= size_);
+
+        if (from_index == to_index)
+            return 0;
+
+        size_t first_word = from_index / WordBits;
+        size_t last_word = (to_index - 1) / WordBits;
+
+        size_t num_set = 0;
+
+        for (size_t word_cnt = first_word; word_cnt <= last_word; ++word_cnt)
+        {
+            Word word = words_[word_cnt];
+
+            if (word_cnt == first_word)
+                word &= ~Word(0) << (from_index % WordBits);
+
+            if (word_cnt == last_word && to_index % WordBits)
+                word &= ~Word(0) >> (WordBits - to_index % WordBits);
+
+            num_set += __builtin_popcountll(word);
+        }
+
+        return num_set;
+    }
+
+    size_t count() const
+    {
+        size_t num_set = 0;
+
+        for (Word word : words_)
+            num_set += __builtin_popcountll(word);
+
+        return num_set;
+    }
+
+    // appends indexes of set bits in [from_index, to_index) to indexes, skips unset words
+    void setIndexes(size_t from_index, size_t to_index, std::vector<unsigned int>& indexes) const
+    {
+        assert (from_index <= to_index);
+        assert (to_index <= size_);
+
+        if (from_index == to_index)
+            return;
+
+        size_t first_word = from_index / WordBits;
+        size_t last_word = (to_index - 1) / WordBits;
+
+        for (size_t word_cnt = first_word; word_cnt <= last_word; ++word_cnt)
+        {
+            Word word = words_[word_cnt];
+
+            if (word_cnt == first_word)
+                word &= ~Word(0) << (from_index % WordBits);
+
+            if (word_cnt == last_word && to_index % WordBits)
+                word &= ~Word(0) >> (WordBits - to_index % WordBits);
+
+            while (word)
+            {
+                indexes.push_back(word_cnt * WordBits + __builtin_ctzll(word));
+                word &= word - 1; // clear lowest set bit
+            }
+        }
+    }
+
+    // assigns num_bits (<= 64) bits starting at index from the lowest bits of bits
+    void assignBits(size_t index, Word bits, size_t num_bits)
+    {
+        assert (num_bits <= WordBits);
+        assert (index + num_bits <= size_);
+
+        if (!num_bits)
+            return;
+
+        Word mask = num_bits == WordBits ? ~Word(0) : (Word(1) << num_bits) - 1;
+        bits &= mask;
+
+        size_t word_index = index / WordBits;
+        size_t bit_shift = index % WordBits;
+
+        words_[word_index] = (words_[word_index] & ~(mask << bit_shift)) | (bits << bit_shift);
+
+        if (bit_shift && bit_shift + num_bits > WordBits) // spans into next word
+        {
+            words_[word_index + 1] = (words_[word_index + 1] & ~(mask >> (WordBits - bit_shift)))
+                    | (bits >> (WordBits - bit_shift));
+        }
+    }
+
+    // returns num_bits (<= 64) bits starting at index in the lowest bits, higher bits unset
+    Word bits(size_t index, size_t num_bits) const
+    {
+        assert (index + num_bits <= size_);
+
+        if (!num_bits)
+            return 0;
+
+        Word bits = readBits(words_.data(), index, num_bits);
+
+        if (num_bits < WordBits)
+            bits &= (Word(1) << num_bits) - 1;
+
+        return bits;
+    }
+
+    // returns num_bits (<= 64) bits starting at index from an external word array in the lowest bits,
+    // only words containing the requested bits are accessed
+    static Word readBits(const Word* words, size_t index, size_t num_bits)
+    {
+        assert (num_bits <= WordBits);
+
+        if (!num_bits)
+            return 0;
+
+        size_t word_index = index / WordBits;
+        size_t bit_shift = index % WordBits;
+
+        Word bits = words[word_index] >> bit_shift;
+
+        if (bit_shift && bit_shift + num_bits > WordBits)
+            bits |= words[word_index + 1] << (WordBits - bit_shift);
+
+        return bits;
+    }
+
+    // appends all bits of other
+    void append(const NullBitmap& other)
+    {
+        if (size_ % WordBits == 0) // aligned, copy words
+        {
+            words_.insert(words_.end(), other.words_.begin(), other.words_.end());
+            size_ += other.size_;
+            return;
+        }
+
+        size_t old_size = size_;
+        resize(size_ + other.size_);
+
+        for (size_t cnt = 0; cnt < other.size_; ++cnt)
+        {
+            if (other.test(cnt))
+                set(old_size + cnt, true);
+        }
+    }
+
+    // removes the first num bits
+    void eraseFront(size_t num)
+    {
+        if (num >= size_)
+        {
+            clear();
+            return;
+        }
+
+        size_t word_shift = num / WordBits;
+        size_t bit_shift = num % WordBits;
+        size_t new_size = size_ - num;
+        size_t new_num_words = numWords(new_size);
+
+        for (size_t word_cnt = 0; word_cnt < new_num_words; ++word_cnt)
+        {
+            Word word = words_[word_cnt + word_shift] >> bit_shift;
+
+            if (bit_shift && word_cnt + word_shift + 1 < words_.size())
+                word |= words_[word_cnt + word_shift + 1] << (WordBits - bit_shift);
+
+            words_[word_cnt] = word;
+        }
+
+        words_.resize(new_num_words);
+        size_ = new_size;
+
+        clearUnusedBits();
+    }
+
+    bool operator==(const NullBitmap& other) const
+    {
+        return size_ == other.size_ && words_ == other.words_;
+    }
+
+private:
+    std::vector<Word> words_;
+    size_t size_ {0};
+
+    static size_t numWords(size_t size) { return (size + WordBits - 1) / WordBits; }
+    static Word bitMask(size_t index) { return Word(1) << (index % WordBits); }
+
+    void clearUnusedBits()
+    {
+        if (size_ % WordBits)
+            words_.back() &= ~Word(0) >> (WordBits - size_ % WordBits);
+    }
+};
@@ -461,7 +461,11 @@ void DBContent::load(dbContent::VariableSet& read_set,
         {
             logdbg << "DBContent " << name_ << ": load: no line specific loading wanted";
 
-            filter_clause = datasource_var.dbColumnName() + " IN (";
+            // min/max range allows pruning of row groups via zone maps
+            auto ds_id_minmax = std::minmax_element(ds_ids_to_load.begin(), ds_ids_to_load.end());
+
+            filter_clause = "(" + datasource_var.dbColumnName() + " BETWEEN " + to_string(*ds_id_minmax.first)
+                    + " AND " + to_string(*ds_id_minmax.second) + " AND " + datasource_var.dbColumnName() + " IN (";
 
             for (auto ds_id_it = ds_ids_to_load.begin(); ds_id_it != ds_ids_to_load.end(); ++ds_id_it)
             {
@@ -471,7 +475,7 @@ void DBContent::load(dbContent::VariableSet& read_set,
                 filter_clause += to_string(*ds_id_it);
             }
 
-            filter_clause += ")";
+            filter_clause += "))";
         }
     }
 
@@ -479,6 +483,9 @@ void DBContent::load(dbContent::VariableSet& read_set,
 
     if (use_filters)
     {
+        // db side filter data (e.g. value lookup tables) needs to be in place before the condition is built
+        COMPASS::instance().filterManager().prepareSQLCondition(name_);
+
         string filter_sql = COMPASS::instance().filterManager().getSQLCondition(name_);
 
         if (filter_sql.size())
@@ -535,7 +542,11 @@ void DBContent::loadFiltered(dbContent::VariableSet& read_set,
     connect(read_job_.get(), &DBContentReadDBJob::doneSignal,
             this, &DBContent::readJobDoneSlot, Qt::QueuedConnection);
 
-    JobManager::instance().addDBJob(read_job_);
+    // reads of different dbcontents may run concurrently if supported by the db
+    if (read_job_->concurrentRead())
+        JobManager::instance().addDBReadJob(read_job_);
+    else
+        JobManager::instance().addDBJob(read_job_);
 }
 
 /**
@@ -11,6 +11,7 @@
 #include "global.h"
 
 #include <algorithm>
+#include <limits>
 
 #include <boost/algorithm/string.hpp>
 
@@ -35,15 +36,25 @@ Chain::~Chain()
 
 void Chain::addIndex (boost::posix_time::ptime timestamp, unsigned int index)
 {
+    assert (!data_released_);
+
     unsigned int idx_int = (unsigned int)indexes_.size();
 
-    timestamp_index_lookup_.insert({timestamp, Index(index, idx_int)});
+    Time::Timestamp ts(timestamp);
+
+    // usually added in time order, otherwise insert after equal timestamps
+    size_t pos = (timestamps_.empty() || timestamps_.back() <= ts) ? timestamps_.size() : upperBound(ts);
+
+    timestamps_.insert(timestamps_.begin() + pos, ts);
+    timestamp_indexes_.insert(timestamp_indexes_.begin() + pos, {timestamp, Index(index, idx_int)});
     indexes_.push_back(index);
+
+    columns_prefetched_ = false;
 }
 
 bool Chain::hasData() const
 {
-    return !timestamp_index_lookup_.empty();
+    return size() > 0;
 }
 
 void Chain::finalize () const
@@ -53,11 +64,105 @@ void Chain::finalize () const
     updateModeACodes();
     updateModeCMinMax();
     updatePositionMinMax();
+    updateColumns();
+}
+
+/**
+ * Releases the timestamp index, the prefetched columns and the reference to the accessor's buffers, e.g. after
+ * the chain has been evaluated. Only the summary information (size, time range, identification, position bounds)
+ * collected in finalize() remains available.
+ */
+void Chain::releaseData()
+{
+    if (data_released_)
+        return;
+
+    released_size_ = timestamps_.size();
+
+    if (!timestamp_indexes_.empty())
+    {
+        released_time_begin_ = timestamp_indexes_.front().first;
+        released_time_end_   = timestamp_indexes_.back().first;
+    }
+
+    // swap to actually free the memory
+    std::vector<Time::Timestamp>().swap(timestamps_);
+    IndexMap().swap(timestamp_indexes_);
+    std::vector<unsigned int>().swap(indexes_);
+
+    std::vector<unsigned int>().swap(ds_ids_);
+    std::vector<TargetPosition>().swap(positions_);
+    std::vector<TargetVelocity>().swap(speeds_);
+    std::vector<unsigned char>().swap(has_speeds_);
+    columns_prefetched_ = false;
+
+    ignored_positions_.reset();
+
+    accessor_.reset();
+
+    data_released_ = true;
 }
 
 unsigned int Chain::size () const
 {
-    return timestamp_index_lookup_.size();
+    if (data_released_)
+        return released_size_;
+
+    return timestamps_.size();
+}
+
+/**
+ * Returns the position of the first timestamp not before ts, branchless binary search.
+ */
+size_t Chain::lowerBound(const Time::Timestamp& ts) const
+{
+    size_t n = timestamps_.size();
+
+    if (!n)
+        return 0;
+
+    const Time::Timestamp* first = timestamps_.data();
+    const Time::Timestamp* base  = first;
+
+    while (n > 1)
+    {
+        size_t half = n / 2;
+        base = (base[ half ] < ts) ? base + half : base;
+        n -= half;
+    }
+
+    return (base - first) + (*base < ts);
+}
+
+/**
+ * Returns the position of the first timestamp after ts, branchless binary search.
+ */
+size_t Chain::upperBound(const Time::Timestamp& ts) const
+{
+    size_t n = timestamps_.size();
+
+    if (!n)
+        return 0;
+
+    const Time::Timestamp* first = timestamps_.data();
+    const Time::Timestamp* base  = first;
+
+    while (n > 1)
+    {
+        size_t half = n / 2;
+        base = (base[ half ] <= ts) ? base + half : base;
+        n -= half;
+    }
+
+    return (base - first) + (*base <= ts);
+}
+
+bool Chain::hasTimestamp(const boost::posix_time::ptime& timestamp) const
+{
+    Time::Timestamp ts(timestamp);
+    size_t pos = lowerBound(ts);
+
+    return pos < timestamps_.size() && timestamps_[ pos ] == ts;
 }
 
 unsigned int Chain::ignoredSize() const
@@ -77,8 +182,10 @@ unsigned int Chain::ignoredSize() const
 
 ptime Chain::timeBegin() const
 {
-    if (timestamp_index_lookup_.size())
-        return timestamp_index_lookup_.begin()->first;
+    if (data_released_ && released_size_)
+        return released_time_begin_;
+    else if (timestamp_indexes_.size())
+        return timestamp_indexes_.front().first;
     else
         throw std::runtime_error("Chain: timeBegin: no data");
 }
@@ -93,8 +200,10 @@ std::string Chain::timeBeginStr() const
 
 ptime Chain::timeEnd() const
 {
-    if (timestamp_index_lookup_.size())
-        return timestamp_index_lookup_.rbegin()->first;
+    if (data_released_ && released_size_)
+        return released_time_end_;
+    else if (timestamp_indexes_.size())
+        return timestamp_indexes_.back().first;
     else
         throw std::runtime_error("Chain: timeEnd: no data");
 }
@@ -178,7 +287,7 @@ bool Chain::isPrimaryOnly () const
 
 const Chain::IndexMap& Chain::timestampIndexes() const
 {
-    return timestamp_index_lookup_;
+    return timestamp_indexes_;
 }
 
 double Chain::latitudeMin() const
@@ -212,15 +321,14 @@ bool Chain::hasPos() const
 
 Chain::DataID Chain::dataID(const boost::posix_time::ptime& timestamp) const
 {
-    const IndexMap& index_map = timestamp_index_lookup_;
-
-    auto range = index_map.equal_range(timestamp);
+    size_t pos = lowerBound(Time::Timestamp(timestamp));
 
-    assert(range.first != index_map.end());
+    assert(pos < timestamp_indexes_.size());
+    assert(timestamp_indexes_[ pos ].first == timestamp);
 
-    assert(range.first->second.idx_internal < index_map.size());
+    assert(timestamp_indexes_[ pos ].second.idx_internal < timestamp_indexes_.size());
 
-    return DataID(timestamp).addIndex(range.first->second);
+    return DataID(timestamp).addIndex(timestamp_indexes_[ pos ].second);
 }
 
 std::vector<DataID> Chain::dataIDsBetween(const boost::posix_time::ptime& timestamp0,
@@ -229,21 +337,21 @@ std::vector<DataID> Chain::dataIDsBetween(const boost::posix_time::ptime& timest
                                           bool include_t1) const
 {
     assert(timestamp0 <= timestamp1);
-    auto it_start = timestamp_index_lookup_.lower_bound(timestamp0);
 
-    if (it_start == timestamp_index_lookup_.end())
+    Time::Timestamp ts0(timestamp0);
+    Time::Timestamp ts1(timestamp1);
+
+    size_t pos_start = include_t0 ? lowerBound(ts0) : upperBound(ts0);
+    size_t pos_end   = include_t1 ? upperBound(ts1) : lowerBound(ts1);
+
+    if (pos_start >= pos_end)
         return {};
 
     std::vector<DataID> ids;
+    ids.reserve(pos_end - pos_start);
 
-    for (auto it = it_start; it != timestamp_index_lookup_.end(); ++it)
-    {
-        bool ok0 = (include_t0 && it->first >= timestamp0) || (!include_t0 && it->first > timestamp0);
-        bool ok1 = (include_t1 && it->first <= timestamp1) || (!include_t1 && it->first < timestamp1);
-        
-        if(ok0 && ok1)
-            ids.push_back(DataID(it->first).addIndex(it->second));
-    }
+    for (size_t pos = pos_start; pos < pos_end; ++pos)
+        ids.push_back(DataID(timestamp_indexes_[ pos ].first).addIndex(timestamp_indexes_[ pos ].second));
 
     return ids;
 }
@@ -252,6 +360,14 @@ unsigned int Chain::dsID(const DataID& id) const
 {
     auto index     = indexFromDataID(id);
 
+    if (columns_prefetched_)
+    {
+        assert (index.idx_internal < ds_ids_.size());
+        assert (ds_ids_[ index.idx_internal ] != std::numeric_limits<unsigned int>::max());
+
+        return ds_ids_[ index.idx_internal ];
+    }
+
     unsigned int index_ext = index.idx_external;
 
     NullableVector<unsigned int>& dsid_vec =
@@ -266,10 +382,24 @@ dbContent::TargetPosition Chain::pos(const DataID& id) const
 {
     auto timestamp = timestampFromDataID(id);
 
-    assert (timestamp_index_lookup_.count(timestamp));
+    assert (hasTimestamp(timestamp));
 
     auto index = indexFromDataID(id);
 
+    if (columns_prefetched_)
+    {
+        assert (index.idx_internal < positions_.size());
+        return positions_[ index.idx_internal ];
+    }
+
+    return readPos(timestamp, index);
+}
+
+/**
+ * Reads the position from the buffers, estimates the altitude if not available.
+ */
+dbContent::TargetPosition Chain::readPos(const boost::posix_time::ptime& timestamp, const Index& index) const
+{
     unsigned int index_ext = index.idx_external;
 
     dbContent::TargetPosition pos;
@@ -348,7 +478,7 @@ boost::optional<TargetPosition> Chain::posOpt(const DataID& id) const
 {
     auto timestamp = timestampFromDataID(id);
 
-    if (!timestamp_index_lookup_.count(timestamp))
+    if (!hasTimestamp(timestamp))
         return {};
     else
         return pos(id);
@@ -368,8 +498,24 @@ boost::optional<dbContent::TargetVelocity> Chain::speed(const DataID& id) const
 {
     auto index = indexFromDataID(id);
 
-    unsigned int index_ext = index.idx_external;
+    if (columns_prefetched_)
+    {
+        assert (index.idx_internal < speeds_.size());
+
+        if (!has_speeds_[ index.idx_internal ])
+            return {};
+
+        return speeds_[ index.idx_internal ];
+    }
 
+    return readSpeed(index.idx_external);
+}
+
+/**
+ * Reads the velocity from the buffers.
+ */
+boost::optional<dbContent::TargetVelocity> Chain::readSpeed(unsigned int index_ext) const
+{
     NullableVector<double>& speed_vec = accessor_->getMetaVar<double>(
                 dbcontent_name_, DBContent::meta_var_ground_speed_);
     NullableVector<double>& track_angle_vec = accessor_->getMetaVar<double>(
@@ -816,11 +962,15 @@ DataMapping Chain::calculateDataMapping(ptime timestamp) const
 
     ret.timestamp_ = timestamp;
 
-    if (timestamp_index_lookup_.count(timestamp)) // found exact time
+    Time::Timestamp ts(timestamp);
+
+    size_t pos = lowerBound(ts);
+
+    if (pos < timestamps_.size() && timestamps_[ pos ] == ts) // found exact time
     {
         ret.has_ref1_ = true;
         ret.timestamp_ref1_ = timestamp;
-        ret.dataid_ref1_ = dataID(timestamp_index_lookup_.find(timestamp)->first);
+        ret.dataid_ref1_ = dataID(timestamp);
 
         ret.has_ref2_ = false;
 
@@ -829,46 +979,24 @@ DataMapping Chain::calculateDataMapping(ptime timestamp) const
         return ret;
     }
 
-    //    Return iterator to lower bound
-    //    Returns an iterator pointing to the first element in the container whose key is not considered to go
-    //    before k (i.e., either it is equivalent or goes after).
-
-    auto lb_it = timestamp_index_lookup_.lower_bound(timestamp);
-
-    //auto ub_it = ref_chain_->upper_bound(tod);
-
-    if (lb_it != timestamp_index_lookup_.end()) // upper tod found
+    if (pos < timestamps_.size()) // upper tod found
     {
-        assert (lb_it->first >= timestamp);
+        assert (timestamps_[ pos ] > ts);
 
         // save upper value
         ret.has_ref2_ = true;
-        ret.timestamp_ref2_ = lb_it->first;
-        ret.dataid_ref2_ = dataID(lb_it->first);
+        ret.timestamp_ref2_ = timestamp_indexes_[ pos ].first;
+        ret.dataid_ref2_ = dataID(ret.timestamp_ref2_);
 
-        // search lower values by decrementing iterator
-        while (lb_it != timestamp_index_lookup_.end()
-               && (timestamp < lb_it->first || lb_it->first == ret.timestamp_ref2_))
+        // all previous timestamps are smaller
+        if (pos > 0) // lower tod found
         {
-            if (lb_it == timestamp_index_lookup_.begin()) // exit condition on first value
-            {
-                if (timestamp < lb_it->first) // set as not found
-                    lb_it = timestamp_index_lookup_.end();
-
-                break;
-            }
-
-            lb_it--;
-        }
-
-        if (lb_it != timestamp_index_lookup_.end() && lb_it->first != ret.timestamp_ref2_) // lower tod found
-        {
-            assert (timestamp >= lb_it->first);
+            assert (timestamps_[ pos - 1 ] < ts);
 
             // add lower value
             ret.has_ref1_ = true;
-            ret.timestamp_ref1_ = lb_it->first;
-            ret.dataid_ref1_ = dataID(lb_it->first);
+            ret.timestamp_ref1_ = timestamp_indexes_[ pos - 1 ].first;
+            ret.dataid_ref1_ = dataID(ret.timestamp_ref1_);
         }
         else // not found, clear previous
         {
@@ -1100,39 +1228,26 @@ DataMappingTimes Chain::findDataMappingTimes(ptime timestamp_ref) const // ref t
     //    Returns an iterator pointing to the first element in the container whose key is not considered to go
     //    before k (i.e., either it is equivalent or goes after).
 
-    auto lb_it = timestamp_index_lookup_.lower_bound(timestamp_ref);
+    size_t pos = lowerBound(Time::Timestamp(timestamp_ref));
 
-    if (lb_it != timestamp_index_lookup_.end()) // upper tod found
+    if (pos < timestamps_.size()) // upper tod found
     {
-        assert (lb_it->first >= timestamp_ref);
+        assert (timestamp_indexes_[ pos ].first >= timestamp_ref);
 
         // save upper value
         ret.has_other2_ = true;
-        ret.timestamp_other2_ = lb_it->first;
-        ret.dataid_other2_ = dataID(lb_it->first);
+        ret.timestamp_other2_ = timestamp_indexes_[ pos ].first;
+        ret.dataid_other2_ = dataID(ret.timestamp_other2_);
 
-        // search lower values by decrementing iterator
-        while (lb_it != timestamp_index_lookup_.end() && (timestamp_ref < lb_it->first || lb_it->first == ret.timestamp_other2_))
+        // all previous timestamps are smaller
+        if (pos > 0) // lower tod found
         {
-            if (lb_it == timestamp_index_lookup_.begin()) // exit condition on first value
-            {
-                if (timestamp_ref < lb_it->first) // set as not found
-                    lb_it = timestamp_index_lookup_.end();
-
-                break;
-            }
-
-            lb_it--;
-        }
-
-        if (lb_it != timestamp_index_lookup_.end() && lb_it->first != ret.timestamp_other2_) // lower tod found
-        {
-            assert (timestamp_ref >= lb_it->first);
+            assert (timestamp_ref > timestamp_indexes_[ pos - 1 ].first);
 
             // add lower value
             ret.has_other1_ = true;
-            ret.timestamp_other1_ = lb_it->first;
-            ret.dataid_other1_ = dataID(lb_it->first);
+            ret.timestamp_other1_ = timestamp_indexes_[ pos - 1 ].first;
+            ret.dataid_other1_ = dataID(ret.timestamp_other1_);
         }
         else // not found, clear previous
         {
@@ -1212,7 +1327,7 @@ void Chain::updateACIDs() const
 {
     acids_.clear();
 
-    if (timestamp_index_lookup_.size())
+    if (timestamps_.size())
     {
         NullableVector<string>& value_vec = accessor_->getMetaVar<string>(dbcontent_name_, DBContent::meta_var_acid_);
         map<string, vector<unsigned int>> distinct_values = value_vec.distinctValuesWithIndexes(indexes_);
@@ -1229,7 +1344,7 @@ void Chain::updateACADs() const
 {
     acads_.clear();
 
-    if (timestamp_index_lookup_.size())
+    if (timestamps_.size())
     {
         NullableVector<unsigned int>& value_vec = accessor_->getMetaVar<unsigned int>(
                     dbcontent_name_, DBContent::meta_var_acad_);
@@ -1250,7 +1365,7 @@ void Chain::updateModeACodes() const
 
     mode_a_codes_.clear();
 
-    if (timestamp_index_lookup_.size())
+    if (timestamps_.size())
     {
         NullableVector<unsigned int>& mode_a_codes = accessor_->getMetaVar<unsigned int>(
                     dbcontent_name_, DBContent::meta_var_m3a_);
@@ -1281,7 +1396,7 @@ void Chain::updateModeCMinMax() const
     has_mode_c_ = false;
     float mode_c_value;
 
-    if (timestamp_index_lookup_.size())
+    if (timestamps_.size())
     {
         NullableVector<float>& modec_codes_ft = accessor_->getMetaVar<float>(dbcontent_name_, DBContent::meta_var_mc_);
 
@@ -1322,7 +1437,7 @@ void Chain::updatePositionMinMax() const
 {
     has_pos_ = false;
 
-    if (timestamp_index_lookup_.size())
+    if (timestamps_.size())
     {
         NullableVector<double>& lats = accessor_->getMetaVar<double>(dbcontent_name_, DBContent::meta_var_latitude_);
         NullableVector<double>& longs = accessor_->getMetaVar<double>(dbcontent_name_, DBContent::meta_var_longitude_);
@@ -1352,6 +1467,50 @@ void Chain::updatePositionMinMax() const
 
 }
 
+/**
+ * Prefetches data source ids, positions and velocities from the buffers into columns by internal index.
+ */
+void Chain::updateColumns() const
+{
+    columns_prefetched_ = false;
+
+    size_t n = indexes_.size();
+
+    ds_ids_.assign(n, std::numeric_limits<unsigned int>::max());
+    positions_.assign(n, TargetPosition());
+    speeds_.assign(n, TargetVelocity());
+    has_speeds_.assign(n, 0);
+
+    if (!n)
+    {
+        columns_prefetched_ = true;
+        return;
+    }
+
+    NullableVector<unsigned int>& dsid_vec =
+            accessor_->getMetaVar<unsigned int>(dbcontent_name_, DBContent::meta_var_ds_id_);
+
+    for (const auto& elem : timestamp_indexes_)
+    {
+        const Index& index = elem.second;
+
+        assert (index.idx_internal < n);
+
+        if (!dsid_vec.isNull(index.idx_external))
+            ds_ids_[ index.idx_internal ] = dsid_vec.get(index.idx_external);
+
+        positions_[ index.idx_internal ] = readPos(elem.first, index);
+
+        auto spd = readSpeed(index.idx_external);
+        if (spd.has_value())
+        {
+            speeds_[ index.idx_internal ]     = *spd;
+            has_speeds_[ index.idx_internal ] = 1;
+        }
+    }
+
+    columns_prefetched_ = true;
+}
 
 } // namespace TargetReport
 
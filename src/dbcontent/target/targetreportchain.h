@@ -6,6 +6,7 @@
 #include "dbcontent/target/targetpositionaccuracy.h"
 #include "dbcontent/target/targetvelocity.h"
 #include "projection/transformation.h"
+#include "util/timestamp.h"
 
 #include "boost/date_time/posix_time/ptime.hpp"
 #include <boost/optional.hpp>
@@ -41,7 +42,7 @@ struct Index
 class DataID
 {
   public:
-    typedef std::pair<const boost::posix_time::ptime, Index> IndexPair;
+    typedef std::pair<boost::posix_time::ptime, Index> IndexPair;
 
     DataID() = default;
     DataID(const boost::posix_time::ptime& timestamp) : timestamp_(timestamp), valid_(true) {}
@@ -112,11 +113,19 @@ struct DataMapping // mapping to respective ref data
     double ref_rocd_{0};
 };
 
+/**
+ * Time-ordered chain of target reports of a single target, referencing data in the accessor's buffers.
+ *
+ * The timestamp index is held in contiguous arrays sorted by timestamp (insertion order for equal
+ * timestamps), searched via branchless binary search on integer timestamps. Positions, velocities and
+ * data source ids are prefetched from the buffers in finalize(), after which lookups do not touch the
+ * buffers anymore.
+ */
 class Chain
 {
 public:
     typedef TargetReport::DataID                                  DataID;
-    typedef std::multimap<boost::posix_time::ptime, Index>      IndexMap;
+    typedef std::vector<DataID::IndexPair>                        IndexMap; // sorted by timestamp
 
     Chain(std::shared_ptr<dbContent::DBContentAccessor> accessor, const std::string& dbcontent_name);
     virtual ~Chain();
@@ -127,6 +136,9 @@ public:
 
     void finalize () const;
 
+    void releaseData();
+    bool dataReleased() const { return data_released_; }
+
     const std::string& dbContent() const { return dbcontent_name_; }
 
     unsigned int size () const;
@@ -229,11 +241,25 @@ protected:
     std::shared_ptr<dbContent::DBContentAccessor> accessor_;
     std::string dbcontent_name_;
 
-    std::multimap<boost::posix_time::ptime, Index> timestamp_index_lookup_; // timestamp -> index
-    std::vector<unsigned int> indexes_;
+    std::vector<Utils::Time::Timestamp> timestamps_; // sorted search keys
+    IndexMap                            timestamp_indexes_; // timestamp -> index, same order as timestamps_
+    std::vector<unsigned int>           indexes_; // external indexes by internal index
+
+    // columns prefetched from the buffers in finalize(), by internal index
+    mutable bool                        columns_prefetched_ {false};
+    mutable std::vector<unsigned int>   ds_ids_;
+    mutable std::vector<TargetPosition> positions_;
+    mutable std::vector<TargetVelocity> speeds_;
+    mutable std::vector<unsigned char>  has_speeds_;
 
     boost::optional<std::vector<bool>> ignored_positions_;
 
+    // summary kept after releaseData()
+    bool                     data_released_ {false};
+    unsigned int             released_size_ {0};
+    boost::posix_time::ptime released_time_begin_;
+    boost::posix_time::ptime released_time_end_;
+
     mutable std::set<std::string> acids_;
     mutable std::set<unsigned int> acads_;
     mutable std::set<unsigned int> mode_a_codes_;
@@ -256,6 +282,14 @@ protected:
     void updateModeACodes() const;
     void updateModeCMinMax() const;
     void updatePositionMinMax() const;
+    void updateColumns() const;
+
+    size_t lowerBound(const Utils::Time::Timestamp& ts) const;
+    size_t upperBound(const Utils::Time::Timestamp& ts) const;
+    bool hasTimestamp(const boost::posix_time::ptime& timestamp) const;
+
+    TargetPosition readPos(const boost::posix_time::ptime& timestamp, const Index& index) const;
+    boost::optional<TargetVelocity> readSpeed(unsigned int index_ext) const;
 
     std::pair<bool, float> estimateAltitude (
             const boost::posix_time::ptime& timestamp, unsigned int index_internal) const;
@@ -293,6 +293,7 @@ void EvaluationData::finalize ()
     loginf << "EvaluationData: finalize";
 
     assert (!finalized_);
+    assert (batch_begin_ == 0);
 
     unsigned int num_targets = target_data_.size();
 
@@ -316,6 +317,55 @@ void EvaluationData::finalize ()
     finalized_ = true;
 }
 
+/**
+ * Finalizes the targets added since the last released batch.
+ */
+void EvaluationData::finalizeBatch ()
+{
+    unsigned int num_targets = target_data_.size();
+
+    assert (batch_begin_ <= num_targets);
+
+    loginf << "EvaluationData: finalizeBatch: targets " << batch_begin_ << "-" << num_targets;
+
+    if (!finalized_)
+    {
+        QApplication::setOverrideCursor(Qt::WaitCursor);
+        {
+            calculator_.updateSectorLayers();
+        }
+        QApplication::restoreOverrideCursor();
+    }
+
+    if (num_targets > batch_begin_)
+    {
+        size_t batch_begin = batch_begin_;
+
+        auto task = [&] (int cnt) { target_data_[batch_begin + cnt].finalize(); return true; };
+
+        Utils::Async::waitDialogAsyncArray(task, (int) (num_targets - batch_begin), "Finalizing data");
+    }
+
+    finalized_ = true;
+}
+
+/**
+ * Releases the raw data of the current batch's targets and the loaded buffers, the next batch starts after them.
+ */
+void EvaluationData::releaseBatchData ()
+{
+    unsigned int num_targets = target_data_.size();
+
+    loginf << "EvaluationData: releaseBatchData: targets " << batch_begin_ << "-" << num_targets;
+
+    for (size_t cnt = batch_begin_; cnt < num_targets; ++cnt)
+        target_data_.modify(target_data_.begin() + cnt, [] (EvaluationTargetData& t) { t.releaseData(); });
+
+    accessor_->clear();
+
+    batch_begin_ = num_targets;
+}
+
 /**
  */
 void EvaluationData::updateToChanges()
@@ -347,7 +397,8 @@ void EvaluationData::clear()
     accessor_->clear();
 
     target_data_.clear();
-    finalized_ = false;
+    finalized_   = false;
+    batch_begin_ = 0;
 
     unassociated_ref_cnt_ = 0;
     associated_ref_cnt_ = 0;
@@ -72,6 +72,11 @@ public:
     void addTestData (const std::string& dbcontent_name, unsigned int line_id);
     void finalize ();
 
+    // streamed evaluation, targets are added, finalized and released in batches
+    void finalizeBatch ();
+    void releaseBatchData ();
+    bool dataReleased() const { return batch_begin_ > 0; }
+
     void updateToChanges();
 
     bool hasTargetData (unsigned int utn);
@@ -165,6 +170,8 @@ protected:
     TargetCache target_data_;
     bool finalized_ {false};
 
+    size_t batch_begin_ {0}; // first target of the current batch, all previous targets are released
+
     unsigned int unassociated_ref_cnt_ {0};
     unsigned int associated_ref_cnt_ {0};
 
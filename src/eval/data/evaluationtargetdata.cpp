@@ -31,6 +31,7 @@
 #include "util/timeconv.h"
 #include "sector/airspace.h"
 #include "sectorlayer.h"
+#include "sector.h"
 #include "evalsectionid.h"
 #include "reportdefs.h"
 
@@ -210,6 +211,32 @@ void EvaluationTargetData::updateToChanges() const
     updateUseInfo();
 }
 
+/**
+ * Releases the raw data of the target (chains, test data mappings, sector inside info) after it has been evaluated.
+ * The target information collected in finalize() remains available, but the target can not be evaluated anymore.
+ */
+void EvaluationTargetData::releaseData()
+{
+    ref_chain_.releaseData();
+    tst_chain_.releaseData();
+
+    std::vector<DataMapping>().swap(tst_data_mappings_);
+
+    inside_ref_.resize(0, 0);
+    inside_tst_.resize(0, 0);
+    inside_map_.resize(0, 0);
+    inside_sector_layers_.clear();
+
+    accessor_.reset();
+}
+
+/**
+ */
+bool EvaluationTargetData::dataReleased() const
+{
+    return ref_chain_.dataReleased();
+}
+
 /**
  */
 unsigned int EvaluationTargetData::numUpdates () const
@@ -1483,21 +1510,40 @@ void EvaluationTargetData::computeSectorInsideInfo() const
 
     auto gb_max_sec = boost::posix_time::seconds(InterpGroundBitMaxSeconds);
 
+    //positions are collected per chain and checked against all sector layers in batch
+    std::vector<unsigned int>                rows;
+    std::vector<dbContent::TargetPosition>   positions;
+    std::vector<boost::optional<bool>>       ground_bits;
+
+    auto clearPositions = [ & ] (size_t n)
+    {
+        rows.clear();
+        positions.clear();
+        ground_bits.clear();
+
+        rows.reserve(n);
+        positions.reserve(n);
+        ground_bits.reserve(n);
+    };
+
     if (num_ref)
     {
         //check ref data for inside
         inside_ref_.resize(num_ref, num_cols);
         inside_ref_.setZero();
 
+        clearPositions(num_ref);
+
         for (const auto& elem : ref_chain_.timestampIndexes())
         {
             DataID id(elem.first, elem.second);
 
-            auto pos = ref_chain_.pos(id);
-            auto gb  = availableRefGroundBit(id, gb_max_sec);
-
-            computeSectorInsideInfo(inside_ref_, pos, elem.second.idx_internal, gb, min_height_layer_ptr);
+            rows.push_back(elem.second.idx_internal);
+            positions.push_back(ref_chain_.pos(id));
+            ground_bits.push_back(availableRefGroundBit(id, gb_max_sec));
         }
+
+        computeSectorInsideInfo(inside_ref_, rows, positions, ground_bits, min_height_layer_ptr);
     }
     if (num_tst)
     {
@@ -1505,15 +1551,18 @@ void EvaluationTargetData::computeSectorInsideInfo() const
         inside_tst_.resize(num_tst, num_cols);
         inside_tst_.setZero();
 
+        clearPositions(num_tst);
+
         for (const auto& elem : tst_chain_.timestampIndexes())
         {
             DataID id(elem.first, elem.second);
 
-            auto pos = tst_chain_.pos(id);
-            auto gb  = availableTstGroundBit(id, gb_max_sec);
-
-            computeSectorInsideInfo(inside_tst_, pos, elem.second.idx_internal, gb, min_height_layer_ptr);
+            rows.push_back(elem.second.idx_internal);
+            positions.push_back(tst_chain_.pos(id));
+            ground_bits.push_back(availableTstGroundBit(id, gb_max_sec));
         }
+
+        computeSectorInsideInfo(inside_tst_, rows, positions, ground_bits, min_height_layer_ptr);
     }
     if (num_map)
     {
@@ -1521,6 +1570,8 @@ void EvaluationTargetData::computeSectorInsideInfo() const
         inside_map_.resize(num_tst, num_cols);
         inside_map_.setZero();
 
+        clearPositions(num_tst);
+
         for (const auto& elem : tst_chain_.timestampIndexes())
         {
             DataID id(elem.first, elem.second);
@@ -1528,10 +1579,13 @@ void EvaluationTargetData::computeSectorInsideInfo() const
             auto pos = mappedRefPos(id);
             if (pos.has_value())
             {
-                auto gb = availableTstGroundBit(id, gb_max_sec);
-                computeSectorInsideInfo(inside_map_, pos.value(), elem.second.idx_internal, gb, min_height_layer_ptr);
+                rows.push_back(elem.second.idx_internal);
+                positions.push_back(pos.value());
+                ground_bits.push_back(availableTstGroundBit(id, gb_max_sec));
             }
         }
+
+        computeSectorInsideInfo(inside_map_, rows, positions, ground_bits, min_height_layer_ptr);
     }
 }
 
@@ -1572,38 +1626,73 @@ boost::optional<bool> EvaluationTargetData::availableTstGroundBit(
 }
 
 /**
+ * Checks the given positions against all sector layers and writes the results to the given rows of mat.
+ * Minimum height and test sensor coverage are checked per position, positions passing both are then
+ * checked against each sector layer in batch.
 */
 void EvaluationTargetData::computeSectorInsideInfo(InsideCheckMatrix& mat, 
-                                                   const dbContent::TargetPosition& pos,
-                                                   unsigned int idx_internal,
-                                                   const boost::optional<bool>& ground_bit,
+                                                   const std::vector<unsigned int>& rows,
+                                                   const std::vector<dbContent::TargetPosition>& positions,
+                                                   const std::vector<boost::optional<bool>>& ground_bits,
                                                    const SectorLayer* min_height_filter) const
 {
-    assert(idx_internal < mat.rows());
+    size_t n = rows.size();
+
+    assert(positions.size() == n);
+    assert(ground_bits.size() == n);
 
     size_t num_sector_layers = inside_sector_layers_.size();
     size_t extra_offset      = num_sector_layers;
 
-    bool has_gb = ground_bit.has_value();
-    bool gb_set = ground_bit.has_value() ? ground_bit.value() : false;
+    SectorInsidePositions      check_positions;
+    std::vector<unsigned int>  check_rows;
+
+    check_positions.reserve(n);
+    check_rows.reserve(n);
 
-    //check airspace if enabled
-    bool above_ok = true;
-    if (min_height_filter)
+    for (size_t i = 0; i < n; ++i)
     {
-        auto res = AirSpace::isAbove(min_height_filter,
-                                     pos,
-                                     has_gb,
-                                     gb_set);
+        const auto& pos = positions[ i ];
+        auto idx_internal = rows[ i ];
+
+        assert(idx_internal < mat.rows());
 
-        if (res == AirSpace::AboveCheckResult::Below)
-            above_ok = false;
+        bool has_gb = ground_bits[ i ].has_value();
+        bool gb_set = ground_bits[ i ].has_value() ? ground_bits[ i ].value() : false;
+
+        //check airspace if enabled
+        bool above_ok = true;
+        if (min_height_filter)
+        {
+            auto res = AirSpace::isAbove(min_height_filter,
+                                         pos,
+                                         has_gb,
+                                         gb_set);
+
+            if (res == AirSpace::AboveCheckResult::Below)
+                above_ok = false;
+        }
+
+        mat(idx_internal, extra_offset     ) = has_gb; // TODO unsused
+        mat(idx_internal, extra_offset + 1 ) = above_ok; // TODO unsused
+
+        if (!above_ok)
+            continue; // outside for all layers
+
+        // calc if insice test sensor coverage, true if not circles
+        if (!calculator_.tstSrcsCoverage().isInside(pos.latitude_, pos.longitude_))
+            continue; // outside test sensor coverage, outside for all layers
+
+        check_positions.add(pos, has_gb, gb_set);
+        check_rows.push_back(idx_internal);
     }
 
-    // calc if insice test sensor coverage, true if not circles
-    bool inside_cov = calculator_.tstSrcsCoverage().isInside(pos.latitude_, pos.longitude_);
+    if (check_rows.empty())
+        return;
 
     // check sector layers
+    std::vector<unsigned char> inside;
+
     for (const auto& sl : inside_sector_layers_)
     {
         auto layer = sl.first;
@@ -1611,19 +1700,13 @@ void EvaluationTargetData::computeSectorInsideInfo(InsideCheckMatrix& mat,
 
         auto lidx = sl.second;
 
-        if (!inside_cov) // outside test sensor coverage
-            mat(idx_internal, lidx) = false;
-        else // check with sectors
-        {
-            bool pos_inside = above_ok && layer->isInside(pos, has_gb, gb_set);
+        layer->isInside(inside, check_positions);
+        assert(inside.size() == check_rows.size());
 
-            //check pos against layer and write to mat
-            mat(idx_internal, lidx) = pos_inside;
-        }
+        //write to mat
+        for (size_t i = 0; i < check_rows.size(); ++i)
+            mat(check_rows[ i ], lidx) = inside[ i ];
     }
-
-    mat(idx_internal, extra_offset     ) = has_gb; // TODO unsused
-    mat(idx_internal, extra_offset + 1 ) = above_ok; // TODO unsused
 }
 
 /**
@@ -72,6 +72,9 @@ public:
     void finalize () const;
     void updateToChanges() const;
 
+    void releaseData();
+    bool dataReleased() const;
+
     const unsigned int utn_{0};
 
     unsigned int numUpdates () const;
@@ -224,9 +227,9 @@ protected:
     void calculateTestDataMappings() const;
     void computeSectorInsideInfo() const;
     void computeSectorInsideInfo(InsideCheckMatrix& mat, 
-                                 const dbContent::TargetPosition& pos,
-                                 unsigned int idx_internal,
-                                 const boost::optional<bool>& ground_bit,
+                                 const std::vector<unsigned int>& rows,
+                                 const std::vector<dbContent::TargetPosition>& positions,
+                                 const std::vector<boost::optional<bool>>& ground_bits,
                                  const SectorLayer* min_height_filter = nullptr) const;
     // bool checkAbove(const InsideCheckMatrix& mat,
     //                 const dbContent::TargetReport::Index& index) const;
@@ -61,6 +61,7 @@
 #include <QMessageBox>
 
 #include <memory>
+#include <algorithm>
 //#include <fstream>
 #include <cstdlib>
 #include <system.h>
@@ -241,6 +242,10 @@ void EvaluationCalculator::readSettings()
 
     //histogram generation
     registerParameter("histogram_num_bins", &settings_.histogram_num_bins, Settings().histogram_num_bins);
+
+    //streamed evaluation
+    registerParameter("stream_evaluation", &settings_.stream_evaluation_, Settings().stream_evaluation_);
+    registerParameter("stream_batch_num_utns", &settings_.stream_batch_num_utns_, Settings().stream_batch_num_utns_);
     
     updateDerivedParameters();
 }
@@ -339,6 +344,7 @@ void EvaluationCalculator::clearData()
 
     data_->clear();
     results_gen_->clear();
+    results_gen_->clearCache();
 
     sector_roi_.reset();
 
@@ -347,15 +353,71 @@ void EvaluationCalculator::clearData()
     data_loaded_            = false;
     evaluated_              = false; 
     active_load_connection_ = false;
+    data_config_hash_       = 0;
+}
+
+/**
+ * Hash of all settings the loaded evaluation data depends on (data sources, load filters, constraints, sector definitions etc.).
+ */
+size_t EvaluationCalculator::dataConfigHash() const
+{
+    nlohmann::json j;
+
+    j["dbcontent_name_ref"] = settings_.dbcontent_name_ref_;
+    j["line_id_ref"       ] = settings_.line_id_ref_;
+    j["active_sources_ref"] = settings_.active_sources_ref_;
+    j["dbcontent_name_tst"] = settings_.dbcontent_name_tst_;
+    j["line_id_tst"       ] = settings_.line_id_tst_;
+    j["active_sources_tst"] = settings_.active_sources_tst_;
+    j["max_ref_time_diff" ] = settings_.max_ref_time_diff_;
+
+    j["use_load_filter"             ] = settings_.use_load_filter_;
+    j["use_ref_traj_accuracy_filter"] = settings_.use_ref_traj_accuracy_filter_;
+    j["ref_traj_minimum_accuracy"   ] = settings_.ref_traj_minimum_accuracy_;
+    j["use_adsb_filter"             ] = settings_.use_adsb_filter_;
+    j["adsb_versions"               ] = { settings_.use_v0_, settings_.use_v1_, settings_.use_v2_ };
+    j["nucp"                        ] = { settings_.use_min_nucp_, settings_.min_nucp_, settings_.use_max_nucp_, settings_.max_nucp_ };
+    j["nic"                         ] = { settings_.use_min_nic_, settings_.min_nic_, settings_.use_max_nic_, settings_.max_nic_ };
+    j["nacp"                        ] = { settings_.use_min_nacp_, settings_.min_nacp_, settings_.use_max_nacp_, settings_.max_nacp_ };
+    j["sil_v1"                      ] = { settings_.use_min_sil_v1_, settings_.min_sil_v1_, settings_.use_max_sil_v1_, settings_.max_sil_v1_ };
+    j["sil_v2"                      ] = { settings_.use_min_sil_v2_, settings_.min_sil_v2_, settings_.use_max_sil_v2_, settings_.max_sil_v2_ };
+    j["min_height_filter_layer"     ] = settings_.min_height_filter_layer_;
+    j["load_only_sector_data"       ] = settings_.load_only_sector_data_;
+
+    j["utns"] = eval_utns_;
+
+    //inside flags are computed for all sector layers on load => any change to the sectors needs a reload
+    j["sector_layers"] = nlohmann::json::array();
+
+    if (sectorsLoaded())
+    {
+        for (const auto& sec_it : sectorLayers())
+            j["sector_layers"].push_back(sec_it->definitionHash());
+    }
+
+    if (sector_roi_.has_value())
+        j["roi"] = { sector_roi_->latitude_min, sector_roi_->latitude_max, sector_roi_->longitude_min, sector_roi_->longitude_max };
+
+    j["use_timestamp_filter"] = eval_man_.useTimestampFilter();
+
+    if (eval_man_.useTimestampFilter())
+    {
+        j["timestamp_begin"     ] = Time::toString(eval_man_.loadTimestampBegin());
+        j["timestamp_end"       ] = Time::toString(eval_man_.loadTimestampEnd());
+        j["excluded_time_windows"] = eval_man_.excludedTimeWindows().asJSON();
+    }
+
+    return std::hash<std::string>()(j.dump());
 }
 
 /**
  */
 Result EvaluationCalculator::evaluate(bool update_report,
                                       const std::vector<unsigned int>& utns,
-                                      const std::vector<Evaluation::RequirementResultID>& requirements)
+                                      const std::vector<Evaluation::RequirementResultID>& requirements,
+                                      bool incremental)
 {
-    loginf << "EvaluationCalculator: evaluate";
+    loginf << "EvaluationCalculator: evaluate: incremental " << incremental;
 
     assert(canEvaluate().ok());
 
@@ -368,6 +430,24 @@ Result EvaluationCalculator::evaluate(bool update_report,
         eval_requirements_ = requirements;
         update_report_     = update_report;
 
+        //loaded data still valid => reevaluate only results affected by changes
+        if (incremental && data_loaded_ && !data_->dataReleased())
+        {
+            updateSectorROI();
+
+            if (dataConfigHash() == data_config_hash_)
+            {
+                loginf << "EvaluationCalculator: evaluate: reusing loaded data";
+
+                eval_man_.resetViewableDataConfig(true);
+
+                //update target specific eval settings (e.g. excluded time windows)
+                data_->updateToChanges();
+
+                return evaluateData();
+            }
+        }
+
         QApplication::setOverrideCursor(QCursor(Qt::WaitCursor));
 
         // remove previous stuff
@@ -387,7 +467,14 @@ Result EvaluationCalculator::evaluate(bool update_report,
         updateCompoundCoverage(activeDataSourcesTst());
         updateSectorROI();
 
-        if (Blocking)
+        if (!Blocking && settings_.stream_evaluation_)
+            logwrn << "EvaluationCalculator: evaluate: streamed evaluation only supported in blocking mode, loading all data";
+
+        if (Blocking && settings_.stream_evaluation_)
+        {
+            return evaluateStreamed();
+        }
+        else if (Blocking)
         {
             eval_man_.loadData(*this, true);
             auto res = loadingDone();
@@ -444,6 +531,8 @@ Result EvaluationCalculator::loadingDone()
 
     data_loaded_ = reference_data_loaded_ || test_data_loaded_;
 
+    data_config_hash_ = dataConfigHash();
+
     //ready to evaluate?
     if (data_loaded_)
     {
@@ -499,6 +588,126 @@ Result EvaluationCalculator::evaluateData()
     return Result::succeeded();
 }
 
+/**
+ * Loads and evaluates the targets in batches of a limited number of UTNs. The raw data of each batch is released
+ * after its single results have been computed, so that peak memory is bounded by the batch size. The single results
+ * are joined after the last batch and match the ones of an in-memory evaluation, single result details are not
+ * available afterwards though.
+ * Only used in blocking mode. Batches are loaded filtered by their UTNs, so unassociated target reports are not
+ * loaded and the unassociated counts of the evaluation data stay zero.
+ */
+Result EvaluationCalculator::evaluateStreamed()
+{
+    std::vector<unsigned int> utns = eval_utns_;
+
+    if (utns.empty())
+    {
+        DBContentManager& dbcont_man = COMPASS::instance().dbContentManager();
+
+        if (!dbcont_man.hasTargetsInfo())
+            return Result::failed("Streamed evaluation failed, no targets available");
+
+        for (const auto& utn : dbcont_man.utnsAsJSON().at("utns"))
+            utns.push_back(utn.get<unsigned int>());
+    }
+
+    //same target order as in an in-memory evaluation
+    std::sort(utns.begin(), utns.end());
+    utns.erase(std::unique(utns.begin(), utns.end()), utns.end());
+
+    const size_t batch_size  = std::max(1u, settings_.stream_batch_num_utns_);
+    const size_t num_batches = (utns.size() + batch_size - 1) / batch_size;
+
+    loginf << "EvaluationCalculator: evaluateStreamed: " << utns.size() << " targets in " << num_batches << " batches";
+
+    boost::posix_time::ptime start_time = boost::posix_time::microsec_clock::local_time();
+
+    Projection& projection = ProjectionManager::instance().currentProjection();
+    projection.clearCoordinateSystems();
+    projection.addAllCoordinateSystems();
+
+    //the batch utns are passed to the load filter
+    auto requested_utns = eval_utns_;
+
+    results_gen_->beginStreamedEvaluation(currentStandard(), eval_requirements_);
+
+    for (size_t batch = 0; batch < num_batches; ++batch)
+    {
+        auto batch_begin = utns.begin() + batch * batch_size;
+        auto batch_end   = utns.begin() + std::min(utns.size(), (batch + 1) * batch_size);
+
+        eval_utns_.assign(batch_begin, batch_end);
+
+        loginf << "EvaluationCalculator: evaluateStreamed: batch " << batch + 1 << "/" << num_batches
+               << " utns " << eval_utns_.front() << "-" << eval_utns_.back();
+
+        eval_man_.loadData(*this, true);
+
+        auto data = eval_man_.fetchData();
+
+        data_->setBuffers(data);
+
+        reference_data_loaded_ |= data.count(settings_.dbcontent_name_ref_) > 0;
+        test_data_loaded_      |= data.count(settings_.dbcontent_name_tst_) > 0;
+
+        data.clear();
+
+        data_->addReferenceData(settings_.dbcontent_name_ref_, settings_.line_id_ref_);
+        data_->addTestData(settings_.dbcontent_name_tst_, settings_.line_id_tst_);
+
+        data_->finalizeBatch();
+
+        results_gen_->evaluateStreamedBatch(eval_utns_);
+
+        data_->releaseBatchData();
+    }
+
+    eval_utns_ = requested_utns;
+
+    //drops the state of the started streamed evaluation and the released target data
+    auto abortStreamed = [ & ] ()
+    {
+        results_gen_->clear();
+        results_gen_->clearCache();
+        data_->clear();
+    };
+
+    if (eval_utns_.empty() && !reference_data_loaded_)
+    {
+        abortStreamed();
+        return Result::failed("Loading data failed, no reference data was loaded");
+    }
+
+    if (eval_utns_.empty() && !test_data_loaded_)
+    {
+        abortStreamed();
+        return Result::failed("Loading data failed, no test data was loaded");
+    }
+
+    data_loaded_ = reference_data_loaded_ || test_data_loaded_;
+
+    //no data loaded => no eval needed
+    if (!data_loaded_)
+    {
+        abortStreamed();
+        return Result::succeeded();
+    }
+
+    results_gen_->endStreamedEvaluation(update_report_);
+
+    evaluated_ = true;
+
+    boost::posix_time::time_duration time_diff = boost::posix_time::microsec_clock::local_time() - start_time;
+
+    loginf << "EvaluationCalculator: evaluateStreamed: done "
+           << String::timeStringFromDouble(time_diff.total_milliseconds() / 1000.0, true);
+
+    emit resultsChanged();
+    emit evaluationDone();
+
+    return Result::succeeded();
+}
+
 /**
  */
 std::map<unsigned int, std::set<unsigned int>> EvaluationCalculator::usedDataSources() const
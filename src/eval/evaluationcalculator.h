@@ -105,7 +105,8 @@ public:
     void clearData();
     Result evaluate(bool update_report = true,
                     const std::vector<unsigned int>& utns = std::vector<unsigned int>(),
-                    const std::vector<Evaluation::RequirementResultID>& requirements = std::vector<Evaluation::RequirementResultID>());
+                    const std::vector<Evaluation::RequirementResultID>& requirements = std::vector<Evaluation::RequirementResultID>(),
+                    bool incremental = false);
     void updateResultsToChanges();
 
     // check and correct missing information
@@ -247,6 +248,9 @@ protected:
     void loadedDataData(const std::map<std::string, std::shared_ptr<Buffer>>& data, bool requires_reset);
     Result loadingDone();
     Result evaluateData();
+    Result evaluateStreamed();
+
+    size_t dataConfigHash() const;
 
     EvaluationManager& eval_man_;
 
@@ -269,6 +273,8 @@ protected:
     bool active_load_connection_ {false};
     bool update_report_          {true };
 
+    size_t data_config_hash_     {0}; // hash of the settings the loaded data depends on
+
     std::vector<std::unique_ptr<EvaluationStandard>> standards_;
 
     std::unique_ptr<EvaluationData>                        data_;
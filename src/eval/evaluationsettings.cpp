@@ -61,6 +61,8 @@ EvaluationSettings::EvaluationSettings()
 ,   report_split_results_by_mops_     (false)
 ,   report_split_results_by_aconly_ms_(false)
 ,   show_ok_joined_target_reports_    (false)
+,   stream_evaluation_                (false)
+,   stream_batch_num_utns_            (500u)
 ,   load_only_sector_data_            (true)
 ,   dbcontent_name_ref_               ("RefTraj")
 ,   dbcontent_name_tst_               ("CAT062")
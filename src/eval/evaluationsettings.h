@@ -103,6 +103,10 @@ struct EvaluationSettings
     //histogram generation
     unsigned int histogram_num_bins = 20;
 
+    //streamed evaluation, loads and evaluates the targets in batches to bound peak memory (blocking evaluation only)
+    bool         stream_evaluation_     {false};
+    unsigned int stream_batch_num_utns_ {500}; // max number of targets loaded at once
+
     //not written to config
     bool load_only_sector_data_ {true};
 
@@ -72,6 +72,8 @@ void Joined::clearResults()
     num_targets_        = 0;
     num_failed_targets_ = 0;
 
+    accumulated_results_.clear();
+
     //invoke derived
     clearResults_impl();
 }
@@ -424,6 +426,8 @@ void Joined::iterateSingleResults(const SingleResultFunc& func,
 void Joined::addSingleResult(std::shared_ptr<Single> other)
 {
     results_.push_back(other);
+
+    accumulated_ = false;
 }
 
 /**
@@ -474,17 +478,14 @@ bool Joined::hasStoredDetails() const
 */
 void Joined::updateToChanges(bool reset_viewable)
 {
-    //clear first
-    clearResults();
-
     //invalidate cached viewable?
     if (reset_viewable)
         viewable_.reset();
 
-    //accumulate single results
     size_t nr = results_.size();
 
-    std::vector<size_t> used;
+    std::vector<size_t>        used;
+    std::vector<const Single*> used_results;
 
     //collect used results
     for (size_t i = 0; i < nr; ++i)
@@ -495,26 +496,42 @@ void Joined::updateToChanges(bool reset_viewable)
         single->setInterestFactor(0, true);
 
         if (resultUsed(single))
+        {
             used.push_back(i);
+            used_results.push_back(single.get());
+        }
     }
 
     size_t nu = used.size();
 
-    //accumulate all used results
-    for (size_t i = 0; i < nu; ++i)
+    //accumulate single results only if the used ones changed since the last accumulation
+    if (!accumulated_ || used_results != accumulated_results_)
     {
-        auto& single = results_[ used[ i ] ];
+        //clear first
+        clearResults();
 
-        ++num_targets_;
+        //accumulate all used results
+        for (size_t i = 0; i < nu; ++i)
+        {
+            auto& single = results_[ used[ i ] ];
 
-        if (single->hasFailed())
-            ++num_failed_targets_;
+            ++num_targets_;
 
-        accumulateSingleResult(single, i == 0, i == nu - 1);
-    }
+            if (single->hasFailed())
+                ++num_failed_targets_;
+
+            accumulateSingleResult(single, i == 0, i == nu - 1);
+        }
+
+        //update result
+        updateResult();
 
-    //update result
-    updateResult();
+        accumulated_results_ = used_results;
+        accumulated_         = true;
+
+        //joined details changed => viewable outdated
+        viewable_.reset();
+    }
 
     //update interests if result is usable
     auto issues_total = numIssues();
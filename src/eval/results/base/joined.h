@@ -154,6 +154,9 @@ private:
     unsigned int num_targets_        = 0;
     unsigned int num_failed_targets_ = 0;
 
+    bool                       accumulated_ = false; // single results accumulated since last change
+    std::vector<const Single*> accumulated_results_; // used single results at last accumulation
+
     mutable std::unique_ptr<Grid2D>                   grid_;
     mutable std::shared_ptr<nlohmann::json::object_t> viewable_;
 };
@@ -241,6 +241,13 @@ Single::EvaluationDetails Single::recomputeDetails() const
 
     const auto& data = calculator_.data().targetData(utn_);
 
+    //raw target data released after a streamed evaluation => details can not be recomputed
+    if (data.dataReleased())
+    {
+        logwrn << "Single: recomputeDetails: data of UTN " << utn_ << " released, details not available";
+        return EvaluationDetails();
+    }
+
     auto result = requirement_->evaluate(data, requirement_, sector_layer_);
     assert(result);
 
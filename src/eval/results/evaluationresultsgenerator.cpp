@@ -46,6 +46,7 @@
 #include "global.h"
 #include "sectorlayer.h"
 #include "async.h"
+#include "json.hpp"
 
 #include <QProgressDialog>
 #include <QApplication>
@@ -58,6 +59,7 @@
 #include "boost/date_time/posix_time/posix_time.hpp"
 
 #include <future>
+#include <functional>
 
 using namespace std;
 using namespace EvaluationRequirementResult;
@@ -172,14 +174,15 @@ void EvaluationResultsGenerator::evaluate(EvaluationStandard& standard,
 
     string remaining_time_str;
 
-    string subresult_str;
-
     for (auto& sec_it : sector_layers)
     {
         const string& sector_layer_name = sec_it->name();
 
         loginf << "EvaluationResultsGenerator: evaluate: sector layer " << sector_layer_name;
 
+        //sector definition the results depend on
+        size_t sector_hash = sec_it->definitionHash();
+
         for (auto& req_group_it : standard)
         {
             if (!req_group_it->used())
@@ -219,8 +222,12 @@ void EvaluationResultsGenerator::evaluate(EvaluationStandard& standard,
                        << " req '" << req_cfg_it->name() << "'";
 
                 std::shared_ptr<EvaluationRequirement::Base> req = req_cfg_it->createRequirement();
-                std::shared_ptr<Joined> result_sum;
-                map<string, std::shared_ptr<Joined>> extra_results_sums;
+
+                //requirement config the results depend on
+                nlohmann::json req_config;
+                req_cfg_it->generateJSON(req_config, Configurable::JSONExportType::General);
+
+                size_t config_hash = std::hash<std::string>()(req_config.dump());
 
                 vector<shared_ptr<Single>> results;
                 results.resize(num_utns);
@@ -229,6 +236,32 @@ void EvaluationResultsGenerator::evaluate(EvaluationStandard& standard,
                 done_flags.resize(num_utns, false);
                 bool task_done = false;
 
+                // reuse cached results whose dependencies did not change
+                vector<unsigned int> eval_indexes;
+
+                for(unsigned int utn_cnt=0; utn_cnt < num_utns; ++utn_cnt)
+                {
+                    unsigned int utn = used_utns.at(utn_cnt);
+
+                    auto cache_it = single_cache_.find(SingleCacheKey(sector_layer_name, requirement_group_name, req_cfg_it->name(), utn));
+
+                    if (cache_it != single_cache_.end() &&
+                        cache_it->second.config_hash == config_hash &&
+                        cache_it->second.sector_hash == sector_hash &&
+                        cache_it->second.target_hash == targetHash(data.targetData(utn)))
+                    {
+                        results[utn_cnt]    = cache_it->second.result;
+                        done_flags[utn_cnt] = true;
+                    }
+                    else
+                    {
+                        eval_indexes.push_back(utn_cnt);
+                    }
+                }
+
+                loginf << "EvaluationResultsGenerator: evaluate:"
+                       << " evaluating " << eval_indexes.size() << " of " << num_utns << " targets";
+
                 // generate results
 //                EvaluateTask* t = new (tbb::task::allocate_root()) EvaluateTask(
 //                            results, used_utns, data, req, *sec_it, done_flags, task_done, false);
@@ -247,19 +280,25 @@ void EvaluationResultsGenerator::evaluate(EvaluationStandard& standard,
                         unsigned int num_utns = used_utns.size();
                         assert (done_flags.size() == num_utns);
 
+                        unsigned int num_evals = eval_indexes.size();
+
                         if (single_thread)
                         {
-                            for(unsigned int utn_cnt=0; utn_cnt < num_utns; ++utn_cnt)
+                            for(unsigned int eval_idx=0; eval_idx < num_evals; ++eval_idx)
                             {
+                                unsigned int utn_cnt = eval_indexes[eval_idx];
+
                                 results[utn_cnt] = req->evaluate(data.targetData(used_utns.at(utn_cnt)), req, sector_layer);
                                 done_flags[utn_cnt] = true;
                             }
                         }
                         else
                         {
-                            tbb::parallel_for(uint(0), num_utns, [&](unsigned int utn_cnt)
+                            tbb::parallel_for(uint(0), num_evals, [&](unsigned int eval_idx)
                                               {
                                                   //assert(num_threads == oneapi::tbb::this_task_arena::max_concurrency());
+                                                  unsigned int utn_cnt = eval_indexes[eval_idx];
+
                                                   results[utn_cnt] = req->evaluate(data.targetData(used_utns.at(utn_cnt)), req, sector_layer);
                                                   done_flags[utn_cnt] = true;
                                               });
@@ -334,77 +373,71 @@ void EvaluationResultsGenerator::evaluate(EvaluationStandard& standard,
 
                 postprocess_dialog.setLabelText(("Sector Layer "+sector_layer_name+":\nAggregating results").c_str());
 
-                for (auto& result_it : results)
+                //store newly evaluated results to cache
+                for (auto utn_cnt : eval_indexes)
                 {
-                    results_[result_it->reqGrpId()][result_it->resultId()] = result_it;
-                    results_vec_.push_back(result_it);
+                    unsigned int utn = used_utns.at(utn_cnt);
 
-                    if (!result_sum)
-                        result_sum = result_it->createEmptyJoined("Sum");
+                    auto& cached = single_cache_[ SingleCacheKey(sector_layer_name, requirement_group_name, req_cfg_it->name(), utn) ];
 
-                    result_sum->addSingleResult(result_it);
-
-                    if (eval_settings.report_split_results_by_mops_)
-                    {
-                        subresult_str = result_it->target()->mopsVersionStr();
-
-                        if (subresult_str == "?")
-                            subresult_str = "Unknown";
+                    cached.config_hash  = config_hash;
+                    cached.target_hash  = targetHash(data.targetData(utn));
+                    cached.sector_hash  = sector_hash;
+                    cached.result       = results[utn_cnt];
+                }
 
-                        subresult_str = "MOPS "+subresult_str;
+                for (auto& result_it : results)
+                {
+                    results_[result_it->reqGrpId()][result_it->resultId()] = result_it;
+                    results_vec_.push_back(result_it);
+                }
 
-                        if (!extra_results_sums.count(subresult_str+" Sum"))
-                            extra_results_sums[subresult_str+" Sum"] =
-                                    result_it->createEmptyJoined(subresult_str+" Sum");
+                //reuse joined results if they were joined from exactly the same single results
+                JoinedCacheKey joined_key(sector_layer_name, requirement_group_name, req_cfg_it->name());
 
-                        extra_results_sums.at(subresult_str+" Sum")->addSingleResult(result_it);
-                    }
+                auto joined_it = joined_cache_.find(joined_key);
 
-                    if (eval_settings.report_split_results_by_aconly_ms_)
-                    {
-                        subresult_str = "Primary";
+                bool reuse_joined = eval_indexes.empty() &&
+                                    joined_it != joined_cache_.end() &&
+                                    joined_it->second.config_hash        == config_hash &&
+                                    joined_it->second.sector_hash        == sector_hash &&
+                                    joined_it->second.split_by_mops      == eval_settings.report_split_results_by_mops_ &&
+                                    joined_it->second.split_by_aconly_ms == eval_settings.report_split_results_by_aconly_ms_ &&
+                                    joined_it->second.singles            == results;
 
-                        if (result_it->target()->isModeS())
-                            subresult_str = "Mode S";
-                        else if (result_it->target()->isModeACOnly())
-                            subresult_str = "Mode A/C";
-                        else
-                            assert (result_it->target()->isPrimaryOnly());
+                vector<shared_ptr<Joined>> joined_results;
 
-                        if (!extra_results_sums.count(subresult_str+" Sum"))
-                            extra_results_sums[subresult_str+" Sum"] =
-                                    result_it->createEmptyJoined(subresult_str+" Sum");
+                if (reuse_joined)
+                {
+                    loginf << "EvaluationResultsGenerator: evaluate: reusing joined results";
 
-                        extra_results_sums.at(subresult_str+" Sum")->addSingleResult(result_it);
-                    }
+                    joined_results = joined_it->second.joined;
                 }
-
-                if (result_sum)
+                else
                 {
-                    loginf << "EvaluationResultsGenerator: evaluate: adding result '" << result_sum->reqGrpId()
-                           << "' id '" << result_sum->resultId() << "'";
-                    assert (!results_[result_sum->reqGrpId()].count(result_sum->resultId()));
+                    joined_results = joinResults(results);
 
-                    //update now => here we still have all details for the joined viewable
-                    result_sum->updateToChanges(true);
+                    auto& cached = joined_cache_[ joined_key ];
 
-                    results_[result_sum->reqGrpId()][result_sum->resultId()] = result_sum;
-                    results_vec_.push_back(result_sum); // has to be added after all singles
+                    cached.config_hash        = config_hash;
+                    cached.sector_hash        = sector_hash;
+                    cached.split_by_mops      = eval_settings.report_split_results_by_mops_;
+                    cached.split_by_aconly_ms = eval_settings.report_split_results_by_aconly_ms_;
+                    cached.singles            = results;
+                    cached.joined             = joined_results;
                 }
 
-                for (auto& mops_res_it : extra_results_sums) // add extra results generated by splits
+                for (auto& joined_res_it : joined_results)
                 {
-                    loginf << "EvaluationResultsGenerator: evaluate: adding extra result '"
-                           << mops_res_it.second->reqGrpId()
-                           << "' id '" << mops_res_it.second->resultId() << "'";
-
-                    assert (!results_[mops_res_it.second->reqGrpId()].count(mops_res_it.second->resultId()));
+                    loginf << "EvaluationResultsGenerator: evaluate: adding joined result '" << joined_res_it->reqGrpId()
+                           << "' id '" << joined_res_it->resultId() << "'";
+                    assert (!results_[joined_res_it->reqGrpId()].count(joined_res_it->resultId()));
 
                     //update now => here we still have all details for the joined viewable
-                    mops_res_it.second->updateToChanges(true);
+                    joined_res_it->updateToChanges(true);
 
-                    results_[mops_res_it.second->reqGrpId()][mops_res_it.second->resultId()] = mops_res_it.second;
-                    results_vec_.push_back(mops_res_it.second); // has to be added after all singles
+                    results_[joined_res_it->reqGrpId()][joined_res_it->resultId()] = joined_res_it;
+                    results_vec_.push_back(joined_res_it); // has to be added after all singles
                 }
 
                 //purge stored single result details
@@ -443,6 +476,228 @@ void EvaluationResultsGenerator::evaluate(EvaluationStandard& standard,
     QApplication::restoreOverrideCursor();
 }
 
+/**
+ * Joins the given single results to the sum result and the extra sum results generated by splits.
+ */
+std::vector<std::shared_ptr<Joined>> EvaluationResultsGenerator::joinResults(const std::vector<std::shared_ptr<Single>>& results) const
+{
+    const auto& eval_settings = calculator_.settings();
+
+    std::shared_ptr<Joined> result_sum;
+    map<string, std::shared_ptr<Joined>> extra_results_sums;
+
+    string subresult_str;
+
+    for (auto& result_it : results)
+    {
+        if (!result_sum)
+            result_sum = result_it->createEmptyJoined("Sum");
+
+        result_sum->addSingleResult(result_it);
+
+        if (eval_settings.report_split_results_by_mops_)
+        {
+            subresult_str = result_it->target()->mopsVersionStr();
+
+            if (subresult_str == "?")
+                subresult_str = "Unknown";
+
+            subresult_str = "MOPS "+subresult_str;
+
+            if (!extra_results_sums.count(subresult_str+" Sum"))
+                extra_results_sums[subresult_str+" Sum"] =
+                        result_it->createEmptyJoined(subresult_str+" Sum");
+
+            extra_results_sums.at(subresult_str+" Sum")->addSingleResult(result_it);
+        }
+
+        if (eval_settings.report_split_results_by_aconly_ms_)
+        {
+            subresult_str = "Primary";
+
+            if (result_it->target()->isModeS())
+                subresult_str = "Mode S";
+            else if (result_it->target()->isModeACOnly())
+                subresult_str = "Mode A/C";
+            else
+                assert (result_it->target()->isPrimaryOnly());
+
+            if (!extra_results_sums.count(subresult_str+" Sum"))
+                extra_results_sums[subresult_str+" Sum"] =
+                        result_it->createEmptyJoined(subresult_str+" Sum");
+
+            extra_results_sums.at(subresult_str+" Sum")->addSingleResult(result_it);
+        }
+    }
+
+    vector<shared_ptr<Joined>> joined_results;
+
+    if (result_sum)
+        joined_results.push_back(result_sum);
+
+    for (auto& extra_res_it : extra_results_sums) // add extra results generated by splits
+        joined_results.push_back(extra_res_it.second);
+
+    return joined_results;
+}
+
+/**
+ * Starts a streamed evaluation, in which the targets are loaded and evaluated batch-wise by evaluateStreamedBatch().
+ * The used requirements are collected in the same order as in evaluate(), so that the final results are identical.
+ */
+void EvaluationResultsGenerator::beginStreamedEvaluation(EvaluationStandard& standard,
+                                                         const std::vector<Evaluation::RequirementResultID>& requirements)
+{
+    loginf << "EvaluationResultsGenerator: beginStreamedEvaluation";
+
+    assert (calculator_.sectorsLoaded());
+
+    clear();
+    clearCache();
+
+    result_name_ = standard.name() + " " + EvalResultName;
+
+    for (auto& sec_it : calculator_.sectorLayers())
+    {
+        const string& sector_layer_name = sec_it->name();
+
+        for (auto& req_group_it : standard)
+        {
+            if (!req_group_it->used())
+                continue;
+
+            const string& requirement_group_name = req_group_it->name();
+
+            if (!calculator_.useGroupInSectorLayer(sector_layer_name, requirement_group_name))
+                continue; // skip if not used
+
+            for (auto& req_cfg_it : *req_group_it)
+            {
+                if (!req_cfg_it->used())
+                    continue;
+
+                //check list of requirements if provided
+                if (!requirements.empty())
+                {
+                    auto it = std::find_if(requirements.begin(), requirements.end(), 
+                        [ & ] (const Evaluation::RequirementResultID& id) 
+                        {
+                            return id.sec_layer_name == sector_layer_name &&
+                                   id.req_group_name == requirement_group_name &&
+                                   id.req_name == req_cfg_it->name();
+                        });
+                    
+                    if (it == requirements.end())
+                        continue;
+                }
+
+                StreamedRequirement streamed_req;
+                streamed_req.sector_layer = sec_it;
+                streamed_req.requirement  = req_cfg_it->createRequirement();
+
+                streamed_requirements_.push_back(streamed_req);
+            }
+        }
+    }
+
+    loginf << "EvaluationResultsGenerator: beginStreamedEvaluation: " << streamed_requirements_.size() << " requirements";
+}
+
+/**
+ * Evaluates all requirements of the streamed evaluation for the given targets, which have to be loaded and finalized.
+ * Only the single results are kept, their details are purged, so that the target data can be released afterwards.
+ */
+void EvaluationResultsGenerator::evaluateStreamedBatch(const std::vector<unsigned int>& utns)
+{
+    auto& data = calculator_.data();
+
+    //targets without data in the batch are skipped, as in evaluate()
+    vector<unsigned int> used_utns;
+
+    for (auto utn : utns)
+        if (data.hasTargetData(utn))
+            used_utns.push_back(utn);
+
+    size_t num_utns = used_utns.size();
+    size_t num_reqs = streamed_requirements_.size();
+
+    loginf << "EvaluationResultsGenerator: evaluateStreamedBatch: " << num_utns << " targets";
+
+    if (!num_utns || !num_reqs)
+        return;
+
+    //reserve result slots first, so that the tasks do not modify the result vectors
+    vector<size_t> offsets(num_reqs);
+
+    for (size_t req_cnt = 0; req_cnt < num_reqs; ++req_cnt)
+    {
+        auto& results = streamed_requirements_[ req_cnt ].results;
+
+        offsets[ req_cnt ] = results.size();
+        results.resize(results.size() + num_utns);
+    }
+
+    auto task = [ & ] (int cnt)
+    {
+        size_t req_cnt = cnt / num_utns;
+        size_t utn_cnt = cnt % num_utns;
+
+        auto& streamed_req = streamed_requirements_[ req_cnt ];
+        auto& result       = streamed_req.results[ offsets[ req_cnt ] + utn_cnt ];
+
+        result = streamed_req.requirement->evaluate(data.targetData(used_utns[ utn_cnt ]), 
+                                                    streamed_req.requirement, 
+                                                    *streamed_req.sector_layer);
+        assert (result);
+
+        //details would keep the target data alive
+        result->purgeStoredDetails();
+
+        return true;
+    };
+
+    Async::waitDialogAsyncArray(task, (int)(num_reqs * num_utns), "Evaluating targets");
+}
+
+/**
+ * Ends a streamed evaluation by joining the single results collected over all batches.
+ */
+void EvaluationResultsGenerator::endStreamedEvaluation(bool update_report)
+{
+    loginf << "EvaluationResultsGenerator: endStreamedEvaluation";
+
+    assert (calculator_.dataLoaded());
+
+    QApplication::setOverrideCursor(QCursor(Qt::WaitCursor));
+
+    for (auto& streamed_req : streamed_requirements_)
+    {
+        for (auto& result_it : streamed_req.results)
+        {
+            results_[result_it->reqGrpId()][result_it->resultId()] = result_it;
+            results_vec_.push_back(result_it);
+        }
+
+        for (auto& joined_res_it : joinResults(streamed_req.results))
+        {
+            assert (!results_[joined_res_it->reqGrpId()].count(joined_res_it->resultId()));
+
+            //single details are not available anymore => viewable is created on demand
+            joined_res_it->updateToChanges(true);
+
+            results_[joined_res_it->reqGrpId()][joined_res_it->resultId()] = joined_res_it;
+            results_vec_.push_back(joined_res_it); // has to be added after all singles
+        }
+    }
+
+    streamed_requirements_.clear();
+
+    //viewables are up-to-date => do not reset them
+    updateToChanges(false, update_report);
+
+    QApplication::restoreOverrideCursor();
+}
+
 /**
  */
 void EvaluationResultsGenerator::clear()
@@ -452,6 +707,25 @@ void EvaluationResultsGenerator::clear()
     results_vec_.clear();
 
     result_name_ = "";
+
+    streamed_requirements_.clear();
+}
+
+/**
+ * Drops all cached results, needed if the evaluation data is reloaded.
+ */
+void EvaluationResultsGenerator::clearCache()
+{
+    single_cache_.clear();
+    joined_cache_.clear();
+}
+
+/**
+ * Hash of the target specific evaluation settings a single result depends on.
+ */
+size_t EvaluationResultsGenerator::targetHash(const EvaluationTargetData& target_data)
+{
+    return std::hash<std::string>()(target_data.excludedTimeWindows().asJSON().dump());
 }
 
 /**
@@ -22,16 +22,30 @@
 #include "evaluationdefs.h"
 #include "evaluationdata.h"
 
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+
 class EvaluationCalculator;
 class EvaluationSettings;
 class EvaluationStandard;
 
 struct RequirementID;
 
+class EvaluationTargetData;
+class SectorLayer;
+
+namespace EvaluationRequirement
+{
+    class Base;
+}
+
 namespace EvaluationRequirementResult
 {
     class Base;
     class Single;
+    class Joined;
 }
 
 namespace ResultReport
@@ -52,6 +66,12 @@ public:
                   const std::vector<Evaluation::RequirementResultID>& requirements = std::vector<Evaluation::RequirementResultID>(),
                   bool update_report = true);
 
+    // streamed evaluation, single results are computed batch-wise on the loaded targets and joined at the end
+    void beginStreamedEvaluation(EvaluationStandard& standard,
+                                 const std::vector<Evaluation::RequirementResultID>& requirements = std::vector<Evaluation::RequirementResultID>());
+    void evaluateStreamedBatch(const std::vector<unsigned int>& utns);
+    void endStreamedEvaluation(bool update_report = true);
+
     typedef std::map<std::string, std::map<std::string, std::shared_ptr<EvaluationRequirementResult::Base>>> ResultMap;
     typedef ResultMap::const_iterator ResultIterator;
     typedef std::vector<std::shared_ptr<EvaluationRequirementResult::Base>> ResultVector;
@@ -66,10 +86,52 @@ public:
     void generateResultsReportGUI();
 
     void clear();
+    void clearCache();
 
     static const std::string EvalResultName;
 
 protected:
+    /// sector layer name, requirement group name, requirement name, utn
+    typedef std::tuple<std::string, std::string, std::string, unsigned int> SingleCacheKey;
+    /// sector layer name, requirement group name, requirement name
+    typedef std::tuple<std::string, std::string, std::string>               JoinedCacheKey;
+
+    /// cached single result together with the state it was computed from
+    struct CachedSingle
+    {
+        size_t config_hash = 0; // requirement config
+        size_t target_hash = 0; // target specific eval settings
+        size_t sector_hash = 0; // sector layer definition
+
+        std::shared_ptr<EvaluationRequirementResult::Single> result;
+    };
+
+    /// cached joined results of a requirement together with the single results they were joined from
+    struct CachedJoined
+    {
+        size_t config_hash        = 0;
+        size_t sector_hash        = 0;
+        bool   split_by_mops      = false;
+        bool   split_by_aconly_ms = false;
+
+        std::vector<std::shared_ptr<EvaluationRequirementResult::Single>> singles;
+        std::vector<std::shared_ptr<EvaluationRequirementResult::Joined>> joined; // sum first, then extra sums
+    };
+
+    /// requirement of a streamed evaluation together with the single results collected over all batches
+    struct StreamedRequirement
+    {
+        std::shared_ptr<SectorLayer>                  sector_layer;
+        std::shared_ptr<EvaluationRequirement::Base> requirement;
+
+        std::vector<std::shared_ptr<EvaluationRequirementResult::Single>> results;
+    };
+
+    static size_t targetHash(const EvaluationTargetData& target_data);
+
+    std::vector<std::shared_ptr<EvaluationRequirementResult::Joined>> joinResults(
+        const std::vector<std::shared_ptr<EvaluationRequirementResult::Single>>& results) const;
+
     void addTargetSection(const std::shared_ptr<ResultReport::Report>& report);
     void addNonResultsContent(const std::shared_ptr<ResultReport::Report>& report);
 
@@ -81,4 +143,10 @@ protected:
     ResultMap    results_;     // rq group+name -> id -> result, e.g. "All:PD"->"UTN:22"-> or "SectorX:PD"->"All"
     ResultVector results_vec_; // ordered as generated
     std::string  result_name_;
+
+    // results of previous evaluations on the same loaded data, reused if their dependencies did not change
+    std::map<SingleCacheKey, CachedSingle> single_cache_;
+    std::map<JoinedCacheKey, CachedJoined> joined_cache_;
+
+    std::vector<StreamedRequirement> streamed_requirements_; // requirements of a running streamed evaluation
 };
@@ -142,12 +142,17 @@ Result EvaluationTaskResult::update_impl(UpdateState state)
 {
     Result res = Result::succeeded();
 
-    if (state == UpdateState::FullUpdateNeeded ||
-        state == UpdateState::Locked)
+    if (state == UpdateState::Locked)
     {
         loginf << "EvaluationTaskResult: update_impl: Running full update";
         res = calculator_->evaluate(true);
     }
+    else if (state == UpdateState::FullUpdateNeeded)
+    {
+        //loaded data and unaffected results are reused if possible
+        loginf << "EvaluationTaskResult: update_impl: Running full incremental update";
+        res = calculator_->evaluate(true, {}, {}, true);
+    }
     else if (state == UpdateState::PartialUpdateNeeded)
     {
         bool needs_recompute = !calculator_->evaluated() || 
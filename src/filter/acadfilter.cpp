@@ -2,6 +2,7 @@
 #include "compass.h"
 #include "acadfilterwidget.h"
 #include "dbcontent/dbcontent.h"
+#include "dbinterface.h"
 #include "dbcontent/dbcontentmanager.h"
 #include "dbcontent/variable/metavariable.h"
 #include "logger.h"
@@ -31,6 +32,13 @@ bool ACADFilter::filters(const std::string& dbo_type)
     return COMPASS::instance().dbContentManager().metaVariable(DBContent::meta_var_acad_.name()).existsIn(dbo_type);
 }
 
+void ACADFilter::prepareCondition(const std::string& dbcontent_name)
+{
+    // large value sets are bound via lookup table
+    if (active_ && values_.size())
+        COMPASS::instance().dbInterface().prepareFilterValues(instanceId(), values_);
+}
+
 std::string ACADFilter::getConditionString(const std::string& dbcontent_name, bool& first)
 {
     logdbg << "ACADFilter: getConditionString: dbo " << dbcontent_name << " active " << active_;
@@ -55,7 +63,8 @@ std::string ACADFilter::getConditionString(const std::string& dbcontent_name, bo
 
         if (values_.size())
         {
-            ss << var.dbColumnName() << " IN (" << String::compress(values_, ',') << ")";
+            // large value sets are bound via lookup table
+            ss << COMPASS::instance().dbInterface().valuesCondition(instanceId(), var.dbColumnName(), values_);
         }
 
         if (null_wanted_)
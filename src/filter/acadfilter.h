@@ -13,6 +13,7 @@ public:
     virtual ~ACADFilter();
 
     virtual std::string getConditionString(const std::string& dbcontent_name, bool& first) override;
+    virtual void prepareCondition(const std::string& dbcontent_name) override;
 
     virtual void generateSubConfigurable(const std::string& class_id,
                                          const std::string& instance_id) override;
@@ -64,6 +64,8 @@ class DBFilter : public Configurable
 
     /// where condition string for a DBContent
     virtual std::string getConditionString(const std::string& dbcontent_name, bool& first);
+    /// prepares db side data used by the condition string (e.g. value lookup tables), called before getConditionString()
+    virtual void prepareCondition(const std::string& dbcontent_name) {}
     bool onlyHasSubFilter() { return conditions_.size() > 0; }
 
     // resets the filter (sub-filters and conditions) to their inital values.
@@ -254,6 +254,18 @@ void FilterManager::checkSubConfigurables()
     }
 }
 
+/**
+ * Prepares db side data needed by the active filters' conditions, needs to be called before getSQLCondition().
+ */
+void FilterManager::prepareSQLCondition(const std::string& dbcontent_name)
+{
+    for (auto& filter : filters_)
+    {
+        if (filter->getActive() && filter->filters(dbcontent_name))
+            filter->prepareCondition(dbcontent_name);
+    }
+}
+
 std::string FilterManager::getSQLCondition(const std::string& dbcontent_name)
 {
     assert(COMPASS::instance().dbContentManager().dbContent(dbcontent_name).loadable());
@@ -66,6 +66,7 @@ public:
     bool useFilters() const;
     void useFilters(bool useFilters);
 
+    void prepareSQLCondition(const std::string& dbcontent_name);
     std::string getSQLCondition(const std::string& dbcontent_name);
 
     unsigned int getNumFilters();
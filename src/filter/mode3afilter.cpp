@@ -2,6 +2,7 @@
 #include "compass.h"
 #include "mode3afilterwidget.h"
 #include "dbcontent/dbcontent.h"
+#include "dbinterface.h"
 #include "dbcontent/dbcontentmanager.h"
 #include "dbcontent/variable/metavariable.h"
 #include "logger.h"
@@ -31,6 +32,13 @@ bool Mode3AFilter::filters(const std::string& dbo_type)
     return COMPASS::instance().dbContentManager().metaVariable(DBContent::meta_var_m3a_.name()).existsIn(dbo_type);
 }
 
+void Mode3AFilter::prepareCondition(const std::string& dbcontent_name)
+{
+    // large value sets are bound via lookup table
+    if (active_ && values_.size())
+        COMPASS::instance().dbInterface().prepareFilterValues(instanceId(), values_);
+}
+
 std::string Mode3AFilter::getConditionString(const std::string& dbcontent_name, bool& first)
 {
     logdbg << "Mode3AFilter: getConditionString: dbo " << dbcontent_name << " active " << active_;
@@ -57,7 +65,8 @@ std::string Mode3AFilter::getConditionString(const std::string& dbcontent_name,
 
         if (values_.size())
         {
-            ss << var.dbColumnName() << " IN (" << String::compress(values_, ',') << ")";
+            // large value sets are bound via lookup table
+            ss << COMPASS::instance().dbInterface().valuesCondition(instanceId(), var.dbColumnName(), values_);
         }
 
         if (null_wanted_)
@@ -19,6 +19,7 @@
 #include "compass.h"
 #include "utnfilterwidget.h"
 #include "dbcontent/dbcontent.h"
+#include "dbinterface.h"
 #include "dbcontent/dbcontentmanager.h"
 #include "dbcontent/variable/metavariable.h"
 #include "logger.h"
@@ -51,6 +52,13 @@ bool UTNFilter::filters(const std::string& dbcont_name)
     return true; // condition string for non-associated dbcontent as well
 }
 
+void UTNFilter::prepareCondition(const std::string& dbcontent_name)
+{
+    // large value sets are bound via lookup table
+    if (active_ && values_.size())
+        COMPASS::instance().dbInterface().prepareFilterValues(instanceId(), values_);
+}
+
 std::string UTNFilter::getConditionString(const std::string& dbcontent_name, bool& first)
 {
     logdbg << "UTNFilter: getConditionString: dbcontent " << dbcontent_name << " active " << active_
@@ -96,7 +104,8 @@ std::string UTNFilter::getConditionString(const std::string& dbcontent_name, boo
 
         if (values_.size())
         {
-            ss << var.dbColumnName() << " IN (" << String::compress(values_, ',') << ")";
+            // large value sets are bound via lookup table
+            ss << COMPASS::instance().dbInterface().valuesCondition(instanceId(), var.dbColumnName(), values_);
         }
 
         if (null_wanted_)
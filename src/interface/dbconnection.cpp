@@ -439,7 +439,9 @@ Result DBConnection::updateBuffer_impl(const std::string& table_name,
                                        const boost::optional<size_t>& idx_from, 
                                        const boost::optional<size_t>& idx_to)
 {
-    auto sql = SQLGenerator(sqlConfiguration()).getCreateDBUpdateStringBind(buffer, key_column, table_name);
+    //the key column is bound last, independent of its position in the buffer
+    std::vector<size_t> bind_indexes;
+    auto sql = SQLGenerator(sqlConfiguration()).getCreateDBUpdateStringBind(buffer, key_column, table_name, &bind_indexes);
 
     auto stmnt = prepareStatement(sql, true);
     assert(stmnt);
@@ -447,7 +449,7 @@ Result DBConnection::updateBuffer_impl(const std::string& table_name,
     if (!stmnt->valid())
         return Result::failed("Could not prepare update statement" + stmnt->lastError());
 
-    auto res = stmnt->executeBuffer(buffer, idx_from, idx_to);
+    auto res = stmnt->executeBuffer(buffer, idx_from, idx_to, bind_indexes);
     if (!res.ok())
         return Result::failed("Could not execute update statement on buffer: " + res.error());
 
@@ -104,6 +104,13 @@ size_t DBInstance::numConcurrentConnections() const
     return concurrent_connections_.size();
 }
 
+/**
+ */
+size_t DBInstance::numReadConnections() const
+{
+    return read_connections_.size();
+}
+
 /**
  */
 Result DBInstance::open(const std::string& file_name)
@@ -195,6 +202,7 @@ void DBInstance::close()
     }
     destroyCustomConnections();
     destroyConcurrentConnections();
+    destroyReadConnections();
 
     close_impl();
 
@@ -320,8 +328,10 @@ DBInstance::ConnectionWrapperPtr DBInstance::createConnectionWrapperPtr(DBConnec
 }
 
 /**
+ * Returns the connection with the given index from the given connection pool,
+ * the connection is created and added to the pool if not yet existing.
  */
-DBConnectionWrapper DBInstance::concurrentConnection(size_t tIdx)
+DBConnectionWrapper DBInstance::pooledConnection(std::map<int, std::unique_ptr<DBConnection>>& pool, size_t idx)
 {
     assert(dbReady());
     assert(sqlConfiguration().supports_mt);
@@ -333,16 +343,16 @@ DBConnectionWrapper DBInstance::concurrentConnection(size_t tIdx)
         boost::mutex::scoped_lock locker(connection_mutex_);
         #endif
 
-        auto it = concurrent_connections_.find(tIdx);
+        auto it = pool.find(idx);
 
-        if (it == concurrent_connections_.end())
+        if (it == pool.end())
         {
             //create wrapper with new connection
             wrapper = createConnectionWrapper(nullptr, false, {});
 
             //no errors => insert
             if (!wrapper.hasError())
-                concurrent_connections_[ tIdx ].reset(wrapper.connection_);
+                pool[ idx ].reset(wrapper.connection_);
         }
         else
         {
@@ -356,6 +366,22 @@ DBConnectionWrapper DBInstance::concurrentConnection(size_t tIdx)
     return wrapper;
 }
 
+/**
+ */
+DBConnectionWrapper DBInstance::concurrentConnection(size_t tIdx)
+{
+    return pooledConnection(concurrent_connections_, tIdx);
+}
+
+/**
+ * Returns a connection from the pool of read connections, which is kept separate from the
+ * concurrent (insert) connections, so that concurrent table reads never share a connection with writes.
+ */
+DBConnectionWrapper DBInstance::readConnection(size_t rIdx)
+{
+    return pooledConnection(read_connections_, rIdx);
+}
+
 /**
  */
 DBInstance::ConnectionWrapperPtr DBInstance::newCustomConnection()
@@ -443,6 +469,20 @@ void DBInstance::destroyConcurrentConnections()
     concurrent_connections_.clear();
 }
 
+/**
+ */
+void DBInstance::destroyReadConnections()
+{
+    #ifdef PROTECT_CONNECTION
+    boost::mutex::scoped_lock locker(connection_mutex_);
+    #endif
+
+    for (auto& rc : read_connections_)
+        rc.second->disconnect();
+    
+    read_connections_.clear();
+}
+
 /**
  */
 ResultT<DBConnection*> DBInstance::createConnection(bool verbose)
@@ -66,12 +66,15 @@ public:
 
     DBConnection& defaultConnection();
     DBConnectionWrapper concurrentConnection(size_t tIdx);
+    DBConnectionWrapper readConnection(size_t rIdx);
     ConnectionWrapperPtr newCustomConnection();
     void destroyCustomConnections();
     void destroyConcurrentConnections();
+    void destroyReadConnections();
 
     size_t numCustomConnections() const;
     size_t numConcurrentConnections() const;
+    size_t numReadConnections() const;
 
     db::SQLConfig sqlConfiguration(bool verbose = false) const;
 
@@ -121,6 +124,7 @@ private:
                                                     bool verbose, 
                                                     const std::function<void(DBConnection*)>& destroyer);
     void destroyCustomConnection(DBConnection* conn);
+    DBConnectionWrapper pooledConnection(std::map<int, std::unique_ptr<DBConnection>>& pool, size_t idx);
 
     DBInterface& interface_;
     std::string  db_filename_;
@@ -130,6 +134,7 @@ private:
 
     std::vector<std::unique_ptr<DBConnection>>   custom_connections_;
     std::map<int, std::unique_ptr<DBConnection>> concurrent_connections_;
+    std::map<int, std::unique_ptr<DBConnection>> read_connections_;
     std::unique_ptr<DBConnection>                default_connection_;
     boost::mutex                                 connection_mutex_;
 
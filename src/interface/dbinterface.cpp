@@ -55,6 +55,7 @@
 #include "files.h"
 #include "timeconv.h"
 #include "number.h"
+#include "stringconv.h"
 #include "asynctask.h"
 
 #include "tbbhack.h"
@@ -69,6 +70,8 @@
 #include <boost/filesystem/path.hpp>
 
 #include <fstream>
+#include <functional>
+#include <cctype>
 
 using namespace Utils;
 using namespace std;
@@ -82,6 +85,8 @@ const string PROP_LONGITUDE_MIN_NAME {"longitude_min"};
 const string PROP_LONGITUDE_MAX_NAME {"longitude_max"};
 
 const size_t DBInterface::TableBulkUpdateMinRows = 50;
+const size_t DBInterface::FilterValueTableMinValues = 50;
+const std::string DBInterface::FilterValueTablePrefix = "filter_values_";
 
 #define PROTECT_INSTANCE
 
@@ -94,6 +99,7 @@ DBInterface::DBInterface(string class_id,
 ,   insert_mt_(true)
 {
     registerParameter("read_chunk_size", &read_chunk_size_, 50000u);
+    registerParameter("read_mt", &read_mt_, true);
 
     createSubConfigurables();
 }
@@ -128,6 +134,8 @@ void DBInterface::reset()
 
     dbcolumn_content_flags_.clear();
 
+    filter_value_tables_.clear();
+
     if (db_instance_)
     {
         db_instance_->close();
@@ -278,6 +286,16 @@ void DBInterface::openDBFileInternal(const std::string& filename, bool overwrite
         if (!existsTaskLogTable())
             createTaskLogTable();
 
+        //remove filter value tables left over from a previous session
+        {
+            #ifdef PROTECT_INSTANCE
+            boost::mutex::scoped_lock locker(instance_mutex_);
+            #endif
+
+            removeFilterValueTables();
+            updateTableInfo();
+        }
+
         //determine maximum report content id
         auto max_id = getMaxReportContentID();
         ResultReport::Section::setCurrentContentID(max_id.has_value() ? max_id.value() + 1 : 0);
@@ -348,6 +366,9 @@ void DBInterface::closeDB()
         #endif
 
         assert (db_instance_);
+
+        removeFilterValueTables();
+
         db_instance_->close();
 
         properties_loaded_ = false;
@@ -2647,12 +2668,145 @@ void DBInterface::updateBuffer(const std::string& table_name,
 }
 
 /**
+ * Writes associations to a temporary benchmark table as after a reconstruction: inserts num_rows record numbers,
+ * then updates the utn of all rows in one bulk update and of num_rows_row_wise rows in ranges small enough for
+ * the row-wise update path. Returns the rates of all steps, the table is removed afterwards.
+ */
+nlohmann::json DBInterface::benchmarkAssociationWrite(size_t num_rows, size_t num_rows_row_wise)
+{
+    assert(ready());
+    assert(num_rows > 0);
+
+    #ifdef PROTECT_INSTANCE
+    boost::mutex::scoped_lock locker(instance_mutex_);
+    #endif
+
+    DBConnection& connection = db_instance_->defaultConnection();
+
+    const std::string table_name = "benchmark_association_write";
+    const std::string key_col    = "rec_num";
+    const std::string utn_col    = "utn";
+
+    num_rows_row_wise = std::min(num_rows_row_wise, num_rows);
+
+    loginf << "DBInterface: benchmarkAssociationWrite: rows " << num_rows << " row-wise rows " << num_rows_row_wise;
+
+    connection.execute("DROP TABLE IF EXISTS " + table_name + ";");
+
+    auto res = connection.createTable(table_name, { DBTableColumnInfo(key_col, PropertyDataType::ULONGINT, true),
+                                                    DBTableColumnInfo(utn_col, PropertyDataType::UINT, false) });
+    if (!res.ok())
+        throw runtime_error("DBInterface: benchmarkAssociationWrite: creating table failed: " + res.error());
+
+    // key column first, as in the association buffers
+    PropertyList list;
+    list.addProperty(key_col, PropertyDataType::ULONGINT);
+    list.addProperty(utn_col, PropertyDataType::UINT);
+
+    shared_ptr<Buffer> buffer = make_shared<Buffer>(list);
+    auto& rec_num_vec = buffer->get<unsigned long>(key_col);
+    auto& utn_vec     = buffer->get<unsigned int>(utn_col);
+
+    for (size_t r = 0; r < num_rows; ++r)
+    {
+        rec_num_vec.set(r, r);
+        utn_vec.setNull(r);
+    }
+
+    nlohmann::json result;
+    result["rows"] = num_rows;
+
+    auto runStep = [ & ] (const std::string& name, size_t num, const std::function<Result()>& step)
+    {
+        boost::posix_time::ptime start_time = boost::posix_time::microsec_clock::local_time();
+
+        Result step_res = step();
+
+        double secs = (boost::posix_time::microsec_clock::local_time() - start_time).total_microseconds() / 1e6;
+        size_t rate = secs > 0 ? (size_t)(num / secs) : 0;
+
+        loginf << "DBInterface: benchmarkAssociationWrite: " << name << " " << num << " row(s) in "
+               << secs << "s (" << rate << " rows/s) ok " << step_res.ok();
+
+        result[name]["rows"]       = num;
+        result[name]["seconds"]    = secs;
+        result[name]["rows_per_s"] = rate;
+        result[name]["ok"]         = step_res.ok();
+
+        if (!step_res.ok())
+            result[name]["error"] = step_res.error();
+
+        return step_res.ok();
+    };
+
+    bool ok = runStep("insert", num_rows, [ & ] () { return connection.insertBuffer(table_name, buffer); });
+
+    for (size_t r = 0; r < num_rows; ++r)
+        utn_vec.set(r, (unsigned int)(r % 5000));
+
+    ok = ok && runStep("update_bulk", num_rows, [ & ] () { return connection.updateBuffer(table_name, buffer, key_col); });
+
+    // ranges below the bulk update threshold
+    const size_t range_size = std::max((size_t)1, TableBulkUpdateMinRows - 1);
+
+    ok = ok && runStep("update_row_wise", num_rows_row_wise, [ & ] ()
+    {
+        for (size_t r = 0; r < num_rows_row_wise; r += range_size)
+        {
+            size_t r1 = std::min(r + range_size, num_rows_row_wise) - 1;
+
+            Result range_res = connection.updateBuffer(table_name, buffer, key_col, r, r1);
+            if (!range_res.ok())
+                return range_res;
+        }
+        return Result::succeeded();
+    });
+
+    res = connection.execute("DROP TABLE IF EXISTS " + table_name + ";");
+    if (!res.ok())
+        logerr << "DBInterface: benchmarkAssociationWrite: could not remove table '" << table_name << "': " << res.error();
+
+    result["ok"] = ok;
+
+    return result;
+}
+
+/**
+ * Checks if dbcontent reads may run concurrently on separate read connections.
+ * Reads are kept on the default connection if performance metrics are collected on it.
+ */
+bool DBInterface::readsConcurrently() const
+{
+    if (!ready() || !read_mt_)
+        return false;
+
+    return db_instance_->sqlConfiguration().supports_mt && !hasActivePerformanceMetrics();
+}
+
+/**
+ * Returns the connection the read of the given dbcontent has been prepared on.
+ */
+DBConnection& DBInterface::readConnection(const DBContent& dbcontent)
+{
+    boost::mutex::scoped_lock locker(read_connection_mutex_);
+
+    auto it = read_connection_indexes_.find(dbcontent.name());
+    if (it == read_connection_indexes_.end())
+        return db_instance_->defaultConnection();
+
+    return db_instance_->readConnection(it->second).connection();
+}
+
+/**
+ * Prepares a chunked read of the given dbcontent. If concurrent_read is set, the read is
+ * executed on a free read connection, so that multiple dbcontents can be read in parallel.
  */
 void DBInterface::prepareRead(const DBContent& dbobject, 
                               VariableSet read_list, 
                               string custom_filter_clause,
                               bool use_order, 
-                              Variable* order_variable)
+                              Variable* order_variable,
+                              bool concurrent_read)
 {
     logdbg << "DBInterface: prepareRead: dbo " << dbobject.name();
 
@@ -2666,6 +2820,51 @@ void DBInterface::prepareRead(const DBContent& dbobject,
 
     Result res;
 
+    if (concurrent_read)
+    {
+        assert(db_instance_->sqlConfiguration().supports_mt);
+
+        size_t read_idx = 0;
+
+        {
+            boost::mutex::scoped_lock locker(read_connection_mutex_);
+
+            assert(!read_connection_indexes_.count(dbobject.name()));
+
+            //use smallest free read connection
+            std::set<size_t> used_indexes;
+            for (const auto& it : read_connection_indexes_)
+                used_indexes.insert(it.second);
+
+            while (used_indexes.count(read_idx))
+                ++read_idx;
+
+            read_connection_indexes_[ dbobject.name() ] = read_idx;
+        }
+
+        logdbg << "DBInterface: prepareRead: dbo " << dbobject.name() << " using read connection " << read_idx;
+
+        try
+        {
+            res = db_instance_->readConnection(read_idx).connection().startRead(read, 0, read_chunk_size_);
+        }
+        catch(const std::exception& ex)
+        {
+            res = Result::failed(ex.what());
+        }
+        catch(...)
+        {
+            res = Result::failed("Unknown error");
+        }
+
+        //release read connection if read could not be started
+        if (!res.ok())
+        {
+            boost::mutex::scoped_lock locker(read_connection_mutex_);
+            read_connection_indexes_.erase(dbobject.name());
+        }
+    }
+    else
     {
         #ifdef PROTECT_INSTANCE
         boost::mutex::scoped_lock locker(instance_mutex_);
@@ -2691,12 +2890,20 @@ std::pair<std::shared_ptr<Buffer>, bool> DBInterface::readDataChunk(const DBCont
     shared_ptr<DBResult> result;
     bool last_one = false;
 
+    DBConnection& connection = readConnection(dbobject);
+
+    if (&connection != &db_instance_->defaultConnection())
+    {
+        //read connections are used by a single read at a time
+        result = connection.readChunk();
+    }
+    else
     {
         #ifdef PROTECT_INSTANCE
         boost::mutex::scoped_lock locker(instance_mutex_);
         #endif
 
-        result = db_instance_->defaultConnection().readChunk();
+        result = connection.readChunk();
     }
 
     if (!result)
@@ -2732,12 +2939,23 @@ void DBInterface::finalizeReadStatement(const DBContent& dbobject)
 {
     assert(ready());
 
+    DBConnection& connection = readConnection(dbobject);
+
+    if (&connection != &db_instance_->defaultConnection())
+    {
+        connection.stopRead();
+
+        //free read connection
+        boost::mutex::scoped_lock locker(read_connection_mutex_);
+        read_connection_indexes_.erase(dbobject.name());
+    }
+    else
     {
         #ifdef PROTECT_INSTANCE
         boost::mutex::scoped_lock locker(instance_mutex_);
         #endif
 
-        db_instance_->defaultConnection().stopRead();
+        connection.stopRead();
     }
 }
 
@@ -2881,6 +3099,133 @@ void DBInterface::createPropertiesTable()
     }
 }
 
+/**
+ * Prepares the value lookup table of the given filter for a following valuesCondition(), needs to be called
+ * before the condition is generated. The table is only (re)filled if the values changed since the last load.
+ */
+void DBInterface::prepareFilterValues(const std::string& filter_name, const std::set<unsigned int>& values)
+{
+    assert(ready());
+
+    //small value sets are inlined
+    if (values.size() < FilterValueTableMinValues)
+        return;
+
+    #ifdef PROTECT_INSTANCE
+    boost::mutex::scoped_lock locker(instance_mutex_);
+    #endif
+
+    DBConnection& connection = db_instance_->defaultConnection();
+
+    std::string table_name = filterValueTableName(filter_name);
+
+    bool exists = filter_value_tables_.count(filter_name);
+
+    if (exists && filter_value_tables_.at(filter_name) == values)
+        return;
+
+    Result res;
+
+    if (!exists)
+        res = connection.createTable(table_name, { DBTableColumnInfo("value", PropertyDataType::UINT, false, false) });
+    else
+        res = connection.deleteTableContents(table_name);
+
+    if (!res.ok())
+    {
+        logerr << "DBInterface: prepareFilterValues: preparing value table for filter '" << filter_name << "' failed: " << res.error();
+        throw runtime_error("DBInterface: prepareFilterValues: preparing value table for filter '" + filter_name + "' failed: " + res.error());
+    }
+
+    //table exists from here on, values are set after a successful fill
+    filter_value_tables_[ filter_name ].clear();
+
+    logdbg << "DBInterface: prepareFilterValues: filling table '" << table_name << "' with " << values.size() << " value(s)";
+
+    PropertyList list;
+    list.addProperty("value", PropertyDataType::UINT);
+
+    shared_ptr<Buffer> buffer = make_shared<Buffer>(list);
+    auto& value_vec = buffer->get<unsigned int>("value");
+
+    unsigned int cnt = 0;
+    for (auto value : values)
+        value_vec.set(cnt++, value);
+
+    res = connection.insertBuffer(table_name, buffer);
+
+    if (!res.ok())
+    {
+        logerr << "DBInterface: prepareFilterValues: filling value table for filter '" << filter_name << "' failed: " << res.error();
+        throw runtime_error("DBInterface: prepareFilterValues: filling value table for filter '" + filter_name + "' failed: " + res.error());
+    }
+
+    filter_value_tables_[ filter_name ] = values;
+}
+
+/**
+ * Returns a condition restricting the given column to the given values. Large value sets are not
+ * inlined as literals, but taken from the lookup table of the filter, so that the query text stays the
+ * same when the values change and long IN lists do not have to be parsed for every loaded dbcontent.
+ * The lookup table needs to be prepared beforehand via prepareFilterValues().
+ */
+std::string DBInterface::valuesCondition(const std::string& filter_name,
+                                         const std::string& column_name,
+                                         const std::set<unsigned int>& values) const
+{
+    assert(values.size());
+
+    if (values.size() < FilterValueTableMinValues)
+        return column_name + " IN (" + String::compress(values, ',') + ")";
+
+    auto it = filter_value_tables_.find(filter_name);
+    assert(it != filter_value_tables_.end() && it->second == values);
+
+    //min/max range allows pruning of row groups via zone maps
+    return "(" + column_name + " BETWEEN " + to_string(*values.begin()) + " AND " + to_string(*values.rbegin())
+        + " AND " + column_name + " IN (SELECT value FROM " + filterValueTableName(filter_name) + "))";
+}
+
+/**
+ * Returns the name of the value lookup table of the given filter.
+ */
+std::string DBInterface::filterValueTableName(const std::string& filter_name)
+{
+    std::string table_name = FilterValueTablePrefix;
+
+    for (auto c : filter_name)
+        table_name += std::isalnum((unsigned char)c) ? (char)std::tolower((unsigned char)c) : '_';
+
+    return table_name;
+}
+
+/**
+ * Removes all filter value tables from the db, including leftovers of a previous session which
+ * has not been closed properly. Needs to be called with locked instance.
+ */
+void DBInterface::removeFilterValueTables()
+{
+    DBConnection& connection = db_instance_->defaultConnection();
+
+    std::set<std::string> table_names;
+
+    for (const auto& value_table : filter_value_tables_)
+        table_names.insert(filterValueTableName(value_table.first));
+
+    for (const auto& table_info : db_instance_->tableInfo())
+        if (table_info.first.find(FilterValueTablePrefix) == 0)
+            table_names.insert(table_info.first);
+
+    for (const auto& table_name : table_names)
+    {
+        auto res = connection.execute("DROP TABLE IF EXISTS " + table_name + ";");
+        if (!res.ok())
+            logerr << "DBInterface: removeFilterValueTables: could not remove table '" << table_name << "': " << res.error();
+    }
+
+    filter_value_tables_.clear();
+}
+
 /**
  */
 void DBInterface::startPerformanceMetrics() const
@@ -138,9 +138,13 @@ public:
     void updateBuffer(const std::string& table_name, const std::string& key_col, std::shared_ptr<Buffer> buffer,
                       int from_index = -1, int to_index = -1);  // no indexes means full buffer
 
+    nlohmann::json benchmarkAssociationWrite(size_t num_rows, size_t num_rows_row_wise);
+
+    bool readsConcurrently() const;
     void prepareRead(const DBContent& dbcontent, dbContent::VariableSet read_list,
                      std::string custom_filter_clause,
-                     bool use_order = false, dbContent::Variable* order_variable = nullptr);
+                     bool use_order = false, dbContent::Variable* order_variable = nullptr,
+                     bool concurrent_read = false);
 
     std::pair<std::shared_ptr<Buffer>, bool> readDataChunk(const DBContent& dbcontent); // last one flag
     void finalizeReadStatement(const DBContent& dbcontent);
@@ -222,6 +226,11 @@ public:
     unsigned int getMaxRefTrackTrackNum();
     boost::optional<unsigned long> getMaxReportContentID();
 
+    void prepareFilterValues(const std::string& filter_name, const std::set<unsigned int>& values);
+    std::string valuesCondition(const std::string& filter_name,
+                                const std::string& column_name,
+                                const std::set<unsigned int>& values) const;
+
     void startPerformanceMetrics() const;
     db::PerformanceMetrics stopPerformanceMetrics() const;
     bool hasActivePerformanceMetrics() const;
@@ -233,6 +242,8 @@ public:
     // ta -> mops versions, nucp_nics, nac_ps
 
     static const size_t TableBulkUpdateMinRows;
+    static const size_t FilterValueTableMinValues;
+    static const std::string FilterValueTablePrefix;
 
 protected:
     virtual void checkSubConfigurables() override {}
@@ -255,6 +266,11 @@ protected:
     void updateTableInfo();
     Result cleanupDBInternal();
 
+    DBConnection& readConnection(const DBContent& dbcontent);
+
+    static std::string filterValueTableName(const std::string& filter_name);
+    void removeFilterValueTables();
+
     std::unique_ptr<DBInstance> db_instance_;
 
     bool properties_loaded_ {false};
@@ -264,6 +280,12 @@ protected:
 
     unsigned int read_chunk_size_;
 
+    bool read_mt_ {true};
+    mutable boost::mutex read_connection_mutex_;
+    std::map<std::string, size_t> read_connection_indexes_; // dbcontent name -> read connection index
+
+    std::map<std::string, std::set<unsigned int>> filter_value_tables_; // filter name -> values in lookup table
+
     std::map<std::string, std::string> properties_;
     std::map<std::string, std::set<std::string>> dbcolumn_content_flags_; // dbtable -> dbcols with content
 
@@ -139,7 +139,8 @@ bool DBPrepare::execute(const ExecOptions* options,
  */
 Result DBPrepare::executeBuffer(const std::shared_ptr<Buffer>& buffer,
                                 const boost::optional<size_t>& idx_from, 
-                                const boost::optional<size_t>& idx_to)
+                                const boost::optional<size_t>& idx_to,
+                                const std::vector<size_t>& bind_indexes)
 {
     if (!prepared_stmnt_ok_)
         logerr << "DBPrepare: executeBuffer: prepared statement invalid";
@@ -160,6 +161,8 @@ Result DBPrepare::executeBuffer(const std::shared_ptr<Buffer>& buffer,
     const auto& properties = b->properties().properties();
     size_t np = properties.size();
 
+    assert(bind_indexes.empty() || bind_indexes.size() == np);
+
     #define UpdateFunc(PDType, DType, Suffix)                                                           \
         bool is_null = b->isNull(p, r);                                                                 \
         bool ok = is_null ? bind_null(bind_idx) : bind_##Suffix(bind_idx, b->get<DType>(pname).get(r)); \
@@ -184,7 +187,7 @@ Result DBPrepare::executeBuffer(const std::shared_ptr<Buffer>& buffer,
             const auto& pname = p.name();
 
             //bind index = 1-based
-            size_t bind_idx = c + 1;
+            size_t bind_idx = bind_indexes.empty() ? c + 1 : bind_indexes[ c ];
 
             SwitchPropertyDataType(dtype, UpdateFunc, NotFoundFunc)
         }
@@ -465,9 +468,10 @@ bool DBScopedPrepare::execute(const DBPrepare::ExecOptions* options,
  */
 Result DBScopedPrepare::executeBuffer(const std::shared_ptr<Buffer>& buffer,
                                       const boost::optional<size_t>& idx_from, 
-                                      const boost::optional<size_t>& idx_to)
+                                      const boost::optional<size_t>& idx_to,
+                                      const std::vector<size_t>& bind_indexes)
 {
-    return db_prepare_->executeBuffer(buffer, idx_from, idx_to);
+    return db_prepare_->executeBuffer(buffer, idx_from, idx_to, bind_indexes);
 }
 
 /**
@@ -21,6 +21,7 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 
 #include <boost/optional.hpp>
 #include <boost/date_time/posix_time/ptime.hpp>
@@ -85,7 +86,8 @@ public:
                  DBResult* result = nullptr);
     Result executeBuffer(const std::shared_ptr<Buffer>& buffer,
                          const boost::optional<size_t>& idx_from = boost::optional<size_t>(), 
-                         const boost::optional<size_t>& idx_to = boost::optional<size_t>());
+                         const boost::optional<size_t>& idx_to = boost::optional<size_t>(),
+                         const std::vector<size_t>& bind_indexes = std::vector<size_t>()); // 1-based bind index per property, default = property index + 1
 
     bool hasError() const { return error_.has_value(); }
     std::string lastError() const { return hasError() ? error_.value() : ""; }
@@ -158,7 +160,8 @@ public:
                  DBResult* result = nullptr);
     Result executeBuffer(const std::shared_ptr<Buffer>& buffer,
                          const boost::optional<size_t>& idx_from = boost::optional<size_t>(), 
-                         const boost::optional<size_t>& idx_to = boost::optional<size_t>());
+                         const boost::optional<size_t>& idx_to = boost::optional<size_t>(),
+                         const std::vector<size_t>& bind_indexes = std::vector<size_t>());
 
     bool hasError() const;
     std::string lastError() const;
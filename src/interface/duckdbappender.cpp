@@ -16,6 +16,7 @@
  */
 
 #include "duckdbappender.h"
+#include "nullablevector.h"
 
 #include "logger.h"
 
@@ -90,3 +91,181 @@ std::string DuckDBScopedAppender::lastAppenderError() const
     assert(ok_);
     return std::string(duckdb_appender_error(appender_));
 }
+
+/**
+ */
+DuckDBAppenderChunk::DuckDBAppenderChunk(DuckDBScopedAppender& appender)
+:   appender_(appender)
+{
+    if (!appender_.valid())
+        return;
+
+    size_t nc = appender_.columnCount();
+
+    std::vector<duckdb_logical_type> types(nc);
+    for (size_t c = 0; c < nc; ++c)
+    {
+        types[ c ] = duckdb_appender_column_type(appender_.appender_, c);
+        column_types_.push_back(duckdb_get_type_id(types[ c ]));
+    }
+
+    chunk_ = duckdb_create_data_chunk(types.data(), nc);
+
+    for (auto& t : types)
+        duckdb_destroy_logical_type(&t);
+
+    valid_mask_.resize((capacity() + 63) / 64);
+}
+
+/**
+ */
+DuckDBAppenderChunk::~DuckDBAppenderChunk()
+{
+    if (chunk_)
+        duckdb_destroy_data_chunk(&chunk_);
+}
+
+/**
+ */
+size_t DuckDBAppenderChunk::capacity() const
+{
+    return duckdb_vector_size();
+}
+
+/**
+ */
+template <typename T>
+void DuckDBAppenderChunk::writeValidity(duckdb_vector v, const NullableVector<T>& vec, size_t from_index, size_t num_rows)
+{
+    size_t num_null = vec.getValidityMask(from_index, valid_mask_.data(), num_rows);
+
+    //no mask allocated and nothing to mask?
+    if (num_null == 0 && !duckdb_vector_get_validity(v))
+        return;
+
+    duckdb_vector_ensure_validity_writable(v);
+    uint64_t* validity = duckdb_vector_get_validity(v);
+    assert(validity);
+
+    std::copy(valid_mask_.begin(), valid_mask_.begin() + (num_rows + 63) / 64, validity);
+}
+
+/**
+ * Fixed-width types are copied as a whole range.
+ */
+template <typename T>
+void DuckDBAppenderChunk::write(size_t col, const NullableVector<T>& vec, size_t from_index, size_t num_rows)
+{
+    assert(valid());
+    assert(num_rows <= capacity());
+
+    duckdb_vector v = duckdb_data_chunk_get_vector(chunk_, col);
+
+    vec.getRange(from_index, (T*)duckdb_vector_get_data(v), num_rows);
+    writeValidity(v, vec, from_index, num_rows);
+}
+
+/**
+ */
+template <>
+void DuckDBAppenderChunk::write(size_t col, const NullableVector<std::string>& vec, size_t from_index, size_t num_rows)
+{
+    assert(valid());
+    assert(num_rows <= capacity());
+
+    duckdb_vector v = duckdb_data_chunk_get_vector(chunk_, col);
+    writeValidity(v, vec, from_index, num_rows);
+
+    for (size_t r = 0; r < num_rows; ++r)
+    {
+        if (!isValid(r))
+            continue;
+
+        std::string str = vec.get(from_index + r);
+        duckdb_vector_assign_string_element_len(v, r, str.c_str(), str.size());
+    }
+}
+
+/**
+ */
+template <>
+void DuckDBAppenderChunk::write(size_t col, const NullableVector<nlohmann::json>& vec, size_t from_index, size_t num_rows)
+{
+    assert(valid());
+    assert(num_rows <= capacity());
+
+    duckdb_vector v = duckdb_data_chunk_get_vector(chunk_, col);
+    writeValidity(v, vec, from_index, num_rows);
+
+    for (size_t r = 0; r < num_rows; ++r)
+    {
+        if (!isValid(r))
+            continue;
+
+        std::string str = vec.get(from_index + r).dump();
+        duckdb_vector_assign_string_element_len(v, r, str.c_str(), str.size());
+    }
+}
+
+/**
+ */
+template <>
+void DuckDBAppenderChunk::write(size_t col, const NullableVector<boost::posix_time::ptime>& vec, size_t from_index, size_t num_rows)
+{
+    assert(valid());
+    assert(num_rows <= capacity());
+
+    duckdb_vector v = duckdb_data_chunk_get_vector(chunk_, col);
+    writeValidity(v, vec, from_index, num_rows);
+
+    int64_t* data = (int64_t*)duckdb_vector_get_data(v);
+
+    for (size_t r = 0; r < num_rows; ++r)
+        data[ r ] = isValid(r) ? Utils::Time::toLong(vec.get(from_index + r)) : 0;
+}
+
+template void DuckDBAppenderChunk::write(size_t, const NullableVector<bool>&, size_t, size_t);
+template void DuckDBAppenderChunk::write(size_t, const NullableVector<char>&, size_t, size_t);
+template void DuckDBAppenderChunk::write(size_t, const NullableVector<unsigned char>&, size_t, size_t);
+template void DuckDBAppenderChunk::write(size_t, const NullableVector<int>&, size_t, size_t);
+template void DuckDBAppenderChunk::write(size_t, const NullableVector<unsigned int>&, size_t, size_t);
+template void DuckDBAppenderChunk::write(size_t, const NullableVector<long>&, size_t, size_t);
+template void DuckDBAppenderChunk::write(size_t, const NullableVector<unsigned long>&, size_t, size_t);
+template void DuckDBAppenderChunk::write(size_t, const NullableVector<float>&, size_t, size_t);
+template void DuckDBAppenderChunk::write(size_t, const NullableVector<double>&, size_t, size_t);
+
+/**
+ */
+void DuckDBAppenderChunk::writeNull(size_t col, size_t num_rows)
+{
+    assert(valid());
+    assert(num_rows <= capacity());
+
+    duckdb_vector v = duckdb_data_chunk_get_vector(chunk_, col);
+
+    duckdb_vector_ensure_validity_writable(v);
+    uint64_t* validity = duckdb_vector_get_validity(v);
+    assert(validity);
+
+    std::fill(validity, validity + (num_rows + 63) / 64, 0);
+}
+
+/**
+ * Appends the first num_rows rows of the chunk and resets it for the next fill.
+ */
+bool DuckDBAppenderChunk::append(size_t num_rows)
+{
+    assert(valid());
+    assert(num_rows <= capacity());
+
+    duckdb_data_chunk_set_size(chunk_, num_rows);
+
+    bool ok = duckdb_append_data_chunk(appender_.appender_, chunk_) == DuckDBSuccess;
+
+    if (!ok)
+        logerr << "DuckDBAppenderChunk: append: failed: " << appender_.lastAppenderError();
+
+    duckdb_data_chunk_reset(chunk_);
+
+    return ok;
+}
@@ -20,14 +20,19 @@
 #include <duckdb.h>
 
 #include "timeconv.h"
+#include "property.h"
 
 #include <string>
+#include <vector>
 
 #include <boost/optional.hpp>
 #include <boost/date_time/posix_time/ptime.hpp>
 
 #include <json.hpp>
 
+template <class T>
+class NullableVector;
+
 /**
  * Handles scoped appending of data to a specific duckdb table.
  * Will flush and destroy the appender on destruction.
@@ -67,6 +72,8 @@ public:
     std::string lastError() const { return hasError() ? error_.value() : ""; }
     
 private:
+    friend class DuckDBAppenderChunk;
+
     void setError(const std::string& err) { error_ = err; }
 
     duckdb_appender appender_;
@@ -76,6 +83,47 @@ private:
     boost::optional<std::string> error_; 
 };
 
+/**
+ * Data chunk matching the column types of an appender's table, which is filled column-wise
+ * from buffer vectors and appended as a whole.
+ * Appended chunks are not casted by duckdb, so the buffer data types need to match the
+ * table column types (see DuckDBExecResult::storesDataType()).
+ */
+class DuckDBAppenderChunk
+{
+public:
+    DuckDBAppenderChunk(DuckDBScopedAppender& appender);
+    virtual ~DuckDBAppenderChunk();
+
+    bool valid() const { return chunk_ != nullptr; }
+    size_t capacity() const;
+    size_t columnCount() const { return column_types_.size(); }
+    duckdb_type columnType(size_t col) const { return column_types_.at(col); }
+
+    template <typename T>
+    void write(size_t col, const NullableVector<T>& vec, size_t from_index, size_t num_rows);
+    void writeNull(size_t col, size_t num_rows);
+
+    bool append(size_t num_rows);
+
+private:
+    template <typename T>
+    void writeValidity(duckdb_vector v, const NullableVector<T>& vec, size_t from_index, size_t num_rows);
+    bool isValid(size_t row) const { return (valid_mask_[ row / 64 ] >> (row % 64)) & 1; }
+
+    DuckDBScopedAppender&    appender_;
+    duckdb_data_chunk        chunk_ = nullptr;
+    std::vector<duckdb_type> column_types_;
+    std::vector<uint64_t>    valid_mask_; // validity of last written column
+};
+
+template <>
+void DuckDBAppenderChunk::write(size_t col, const NullableVector<std::string>& vec, size_t from_index, size_t num_rows);
+template <>
+void DuckDBAppenderChunk::write(size_t col, const NullableVector<nlohmann::json>& vec, size_t from_index, size_t num_rows);
+template <>
+void DuckDBAppenderChunk::write(size_t col, const NullableVector<boost::posix_time::ptime>& vec, size_t from_index, size_t num_rows);
+
 #define StandardApppender(DType, DuckDBDTypeName)                                     \
 template<>                                                                            \
 inline bool DuckDBScopedAppender::append(const DType& value)                          \
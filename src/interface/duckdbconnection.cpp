@@ -288,57 +288,129 @@ Result DuckDBConnection::insertBuffer_impl(const std::string& table_name,
     unsigned int r1 = idx_to.has_value()   ? idx_to.value() + 1 : n;
     assert(r0 <= r1);
 
-    auto appender_ptr = appender.get();
+    boost::posix_time::ptime start_time = boost::posix_time::microsec_clock::local_time();
 
-    std::vector<std::function<bool(size_t)>> importers(np);
+    //check if buffer can be appended chunk-wise (chunks are not casted, so types need to match the table exactly)
+    std::unique_ptr<DuckDBAppenderChunk> chunk;
 
-    for (unsigned int c = 0; c < np; ++c)
+    if (duckDBInstance()->settings().append_chunks)
     {
-        if (!has_property[ c ])
+        chunk.reset(new DuckDBAppenderChunk(*appender));
+
+        bool can_write = chunk->valid() && chunk->columnCount() == np;
+
+        for (unsigned int c = 0; can_write && c < np; ++c)
         {
-            //property not available => add null appender
-            importers[ c ] = [ appender_ptr ] (size_t row) { return appender_ptr->appendNull(); };
-            continue;
+            if (has_property[ c ])
+                can_write = DuckDBExecResult::storesDataType(chunk->columnType(c),
+                                                             buffer->properties().get(properties->at(c).name()).dataType());
         }
 
-        const auto& p     = properties->at(c);
-        const auto& pname = p.name();
-        const auto& pb    = buffer->properties().get(p.name());      
+        if (!can_write)
+            chunk.reset();
+    }
+
+    bool append_chunks = chunk != nullptr;
 
-        auto dtype = pb.dataType();
+    if (append_chunks)
+    {
+        #define ChunkWriteFunc(PDType, DType, Suffix)                           \
+            chunk->write<DType>(c, buffer->get<DType>(pname), r, num_rows);
 
-        SwitchPropertyDataType(dtype, UpdateFunc, NotFoundFunc);
-    }
+        #define ChunkNotFoundFunc                                                                                 \
+            logerr << "DuckDBConnection: insertBuffer_impl: unknown property type " << Property::asString(dtype); \
+            assert(false);
 
-    for (unsigned int r = r0; r < r1; ++r)
+        //fill and append chunks column-wise
+        for (size_t r = r0; r < r1; r += chunk->capacity())
+        {
+            size_t num_rows = std::min(chunk->capacity(), r1 - r);
+
+            for (unsigned int c = 0; c < np; ++c)
+            {
+                if (!has_property[ c ])
+                {
+                    chunk->writeNull(c, num_rows);
+                    continue;
+                }
+
+                const auto& pname = properties->at(c).name();
+                auto dtype = buffer->properties().get(pname).dataType();
+
+                SwitchPropertyDataType(dtype, ChunkWriteFunc, ChunkNotFoundFunc)
+            }
+
+            if (!chunk->append(num_rows))
+                return Result::failed("Appending duckdb data chunk failed: " + appender->lastAppenderError());
+        }
+
+        #undef ChunkWriteFunc
+        #undef ChunkNotFoundFunc
+    }
+    else
     {
-        //loginf << "appending row " << std::to_string(r + 1) << "/" << std::to_string(n);
+        auto appender_ptr = appender.get();
+
+        std::vector<std::function<bool(size_t)>> importers(np);
 
         for (unsigned int c = 0; c < np; ++c)
         {
-            bool ok = importers[ c ](r);
+            if (!has_property[ c ])
+            {
+                //property not available => add null appender
+                importers[ c ] = [ appender_ptr ] (size_t row) { return appender_ptr->appendNull(); };
+                continue;
+            }
+
+            const auto& p     = properties->at(c);
+            const auto& pname = p.name();
+            const auto& pb    = buffer->properties().get(p.name());      
+
+            auto dtype = pb.dataType();
 
-            if (!ok)
-                logerr << "DuckDBConnection: insertBuffer_impl: appending column " << c << " failed: " << appender->lastError();
-            assert(ok);
+            SwitchPropertyDataType(dtype, UpdateFunc, NotFoundFunc);
         }
-        assert(appender->currentColumnCount() == np);
-        appender->endRow();
 
-        //if (r % 2000 == 0)
-        //    appender->flush();
+        for (unsigned int r = r0; r < r1; ++r)
+        {
+            //loginf << "appending row " << std::to_string(r + 1) << "/" << std::to_string(n);
+
+            for (unsigned int c = 0; c < np; ++c)
+            {
+                bool ok = importers[ c ](r);
+
+                if (!ok)
+                    logerr << "DuckDBConnection: insertBuffer_impl: appending column " << c << " failed: " << appender->lastError();
+                assert(ok);
+            }
+            assert(appender->currentColumnCount() == np);
+            appender->endRow();
+
+            //if (r % 2000 == 0)
+            //    appender->flush();
+        }
     }
 
     appender->flush();
 
     //cleanup appender
+    chunk.reset();
     appender.reset();
 
+    double secs = (boost::posix_time::microsec_clock::local_time() - start_time).total_microseconds() / 1e6;
+
+    logdbg << "DuckDBConnection: insertBuffer_impl: inserted " << r1 - r0 << " row(s) into '" << table_name
+           << "' " << (append_chunks ? "chunk-wise" : "row-wise") << " in " << secs << "s ("
+           << (secs > 0 ? (size_t)((r1 - r0) / secs) : 0) << " rows/s)";
+
     return Result::succeeded();
 }
 
 /**
  * In DuckDB we update via a temporary table which seems to be much faster.
+ * The buffer data is appended to the temporary table and applied to the target table using a single
+ * UPDATE ... FROM statement inside one transaction. Small updates use the prepared row-wise UPDATE,
+ * for which the temporary table overhead does not pay off.
  */
 Result DuckDBConnection::updateBuffer_impl(const std::string& table_name, 
                                            const std::shared_ptr<Buffer>& buffer,
@@ -349,6 +421,15 @@ Result DuckDBConnection::updateBuffer_impl(const std::string& table_name,
     if (!buffer || buffer->properties().size() == 0 || buffer->size() == 0)
         return Result::failed("Input buffer invalid");
 
+    size_t idx0 = idx_from.has_value() ? idx_from.value()   : 0;
+    size_t idx1 = idx_to.has_value()   ? idx_to.value() + 1 : buffer->size();
+    assert(idx1 >= idx0);
+
+    if (idx1 - idx0 < DBInterface::TableBulkUpdateMinRows)
+        return DBConnection::updateBuffer_impl(table_name, buffer, key_column, idx_from, idx_to);
+
+    boost::posix_time::ptime start_time = boost::posix_time::microsec_clock::local_time();
+
     //create temporary table for buffer data
     std::vector<DBTableColumnInfo> table_columns;
     for (const auto& p : buffer->properties().properties())
@@ -358,12 +439,6 @@ Result DuckDBConnection::updateBuffer_impl(const std::string& table_name,
     if (!temp_table.valid())
         return Result::failed("Could not create temporary table for transaction: " + temp_table.result().error());
 
-    //insert buffer data into temp table
-    auto res_insert = insertBuffer(temp_table.name(), buffer, idx_from, idx_to);
-    if (!res_insert.ok())
-        return res_insert;
-
-    //assign temp table data to target table
     std::vector<std::string> update_columns;
     bool key_col_found = false;
     for (const auto& p : buffer->properties().properties())
@@ -376,14 +451,39 @@ Result DuckDBConnection::updateBuffer_impl(const std::string& table_name,
 
     if (!key_col_found)
         return Result::failed("Key column '" + key_column + "' not found in buffer");
-    
+
+    auto res_begin = execute("BEGIN TRANSACTION;");
+    if (!res_begin.ok())
+        return res_begin;
+
+    auto rollback = [ & ] (const Result& res)
+    {
+        execute("ROLLBACK;");
+        return res;
+    };
+
+    //insert buffer data into temp table
+    auto res_insert = insertBuffer(temp_table.name(), buffer, idx_from, idx_to);
+    if (!res_insert.ok())
+        return rollback(res_insert);
+
+    //assign temp table data to target table
     auto sql = sqlGenerator().getUpdateTableFromTableStatement(temp_table.name(),
                                                                table_name,
                                                                update_columns,
                                                                key_column);
     auto res_sql = execute(sql);
     if (!res_sql.ok())
-        return res_sql;
+        return rollback(res_sql);
+
+    auto res_commit = execute("COMMIT;");
+    if (!res_commit.ok())
+        return rollback(res_commit);
+
+    double secs = (boost::posix_time::microsec_clock::local_time() - start_time).total_microseconds() / 1e6;
+
+    logdbg << "DuckDBConnection: updateBuffer_impl: updated " << idx1 - idx0 << " row(s) in '" << table_name
+           << "' in " << secs << "s (" << (secs > 0 ? (size_t)((idx1 - idx0) / secs) : 0) << " rows/s)";
 
     return Result::succeeded();
 }
@@ -22,6 +22,35 @@
 
 #include <cassert>
 
+/**
+ * Fixed-width types are stored contiguously in DuckDB vectors and in the buffer vectors,
+ * so a whole range is copied at once and the validity mask is converted word-wise.
+ * As in the per-row read, null entries end up as T() in the buffer vector (see setNullFromValidityMask()).
+ */
+#define FixedWidthReadVectorRange(DType)                                            \
+template<>                                                                         \
+void DuckDBExecResult::readVectorRange(NullableVector<DType>& vec,                 \
+                                       void* v,                                    \
+                                       uint64_t* validity,                         \
+                                       idx_t row0,                                 \
+                                       size_t buf_idx0,                            \
+                                       size_t num_rows)                            \
+{                                                                                  \
+    assert(result_valid_);                                                         \
+    vec.setRange(buf_idx0, ((const DType*)v) + row0, num_rows);                    \
+    if (validity)                                                                  \
+        vec.setNullFromValidityMask(buf_idx0, validity, row0, num_rows);           \
+}
+
+FixedWidthReadVectorRange(char)
+FixedWidthReadVectorRange(unsigned char)
+FixedWidthReadVectorRange(int)
+FixedWidthReadVectorRange(unsigned int)
+FixedWidthReadVectorRange(long)
+FixedWidthReadVectorRange(unsigned long)
+FixedWidthReadVectorRange(float)
+FixedWidthReadVectorRange(double)
+
 /**
  */
 PropertyDataType DuckDBExecResult::dataTypeFromDuckDB(duckdb_type type)
@@ -55,6 +84,41 @@ PropertyDataType DuckDBExecResult::dataTypeFromDuckDB(duckdb_type type)
     return PropertyDataType::BOOL;
 }
 
+/**
+ * Checks if the given DuckDB column type stores the raw data of the given property data type, so that
+ * data can be copied between DuckDB vectors and buffer vectors without casting (chunk-wise reads and appends).
+ */
+bool DuckDBExecResult::storesDataType(duckdb_type type, PropertyDataType dtype)
+{
+    switch (dtype)
+    {
+        case PropertyDataType::BOOL:
+            return type == duckdb_type::DUCKDB_TYPE_BOOLEAN;
+        case PropertyDataType::CHAR:
+            return type == duckdb_type::DUCKDB_TYPE_TINYINT;
+        case PropertyDataType::UCHAR:
+            return type == duckdb_type::DUCKDB_TYPE_UTINYINT;
+        case PropertyDataType::INT:
+            return type == duckdb_type::DUCKDB_TYPE_INTEGER;
+        case PropertyDataType::UINT:
+            return type == duckdb_type::DUCKDB_TYPE_UINTEGER;
+        case PropertyDataType::LONGINT:
+        case PropertyDataType::TIMESTAMP: // stored as int64
+            return type == duckdb_type::DUCKDB_TYPE_BIGINT;
+        case PropertyDataType::ULONGINT:
+            return type == duckdb_type::DUCKDB_TYPE_UBIGINT;
+        case PropertyDataType::FLOAT:
+            return type == duckdb_type::DUCKDB_TYPE_FLOAT;
+        case PropertyDataType::DOUBLE:
+            return type == duckdb_type::DUCKDB_TYPE_DOUBLE;
+        case PropertyDataType::STRING:
+        case PropertyDataType::JSON:
+            return type == duckdb_type::DUCKDB_TYPE_VARCHAR;
+    }
+
+    return false;
+}
+
 /**
  */
 DuckDBExecResult::DuckDBExecResult() = default;
@@ -194,6 +258,11 @@ bool DuckDBExecResult::toBuffer(Buffer& buffer,
     if (r0 >= r1 || r0 >= row_count)
         return true;
 
+    //reading the whole result, no chunk fetched yet and all columns stored as read? => read column-wise via chunks
+    //note: the value api must not be used on a result once chunks were fetched, so only whole results are read this way
+    if (r0 == 0 && r1 == row_count && !chunk_.has_value() && columnTypesMatch(properties))
+        return readNextChunk(buffer, r1).ok();
+
     //read rows into buffer
     for (idx_t r = r0, buf_idx = 0; r < r1; ++r, ++buf_idx)
     {
@@ -246,6 +315,28 @@ void DuckDBExecResult::fetchVectors(std::vector<void*>& data_vectors,
     }
 }
 
+/**
+ * Checks if all result columns hold the raw data expected for the respective buffer properties,
+ * e.g. COUNT(*) results are BIGINT even if read into an INT property.
+ */
+bool DuckDBExecResult::columnTypesMatch(const PropertyList& properties) const
+{
+    idx_t col_count = duckdb_column_count(&result_);
+
+    if (col_count != properties.size())
+        return false;
+
+    for (idx_t c = 0; c < col_count; ++c)
+    {
+        duckdb_type type = duckdb_column_type(&result_, c);
+
+        if (!storesDataType(type, properties.at(c).dataType()))
+            return false;
+    }
+
+    return true;
+}
+
 /**
  */
 bool DuckDBExecResult::hasChunk() const
@@ -290,10 +381,9 @@ ResultT<bool> DuckDBExecResult::readNextChunk(Buffer& buffer,
         auto data_vec  = data_vectors[ c ];                                                           \
         auto valid_vec = valid_vectors[ c ];                                                          \
                                                                                                       \
-        auto cb = [ vec_ptr, data_vec, valid_vec, this ] (size_t row, size_t buf_idx)                 \
+        auto cb = [ vec_ptr, data_vec, valid_vec, this ] (size_t row0, size_t buf_idx0, size_t n)     \
         {                                                                                             \
-            bool is_null = !duckdb_validity_row_is_valid(valid_vec, row);                             \
-            if (!is_null) vec_ptr->set(buf_idx, this->readVector<DType>(data_vec, row));              \
+            this->readVectorRange<DType>(*vec_ptr, data_vec, valid_vec, row0, buf_idx0, n);           \
         };                                                                                            \
                                                                                                       \
         readers[ c ] = cb;
@@ -302,7 +392,7 @@ ResultT<bool> DuckDBExecResult::readNextChunk(Buffer& buffer,
         logerr << "DuckDBExecResult: readNextChunk: unknown property type " << Property::asString(dtype); \
         assert(false);
 
-    std::vector<std::function<void(size_t, size_t)>> readers(np);
+    std::vector<std::function<void(size_t, size_t, size_t)>> readers(np);
 
     auto updateReaders = [ & ] ()
     {
@@ -322,16 +412,16 @@ ResultT<bool> DuckDBExecResult::readNextChunk(Buffer& buffer,
     size_t buf_idx = 0;
     while (buf_idx < max_entries && chunk_.value() != nullptr)
     {
-        //read until chunk's end
-        for (size_t r = chunk_idx_; r < chunk_num_rows_; ++r, ++buf_idx, ++chunk_idx_)
-        {
-            //reached max entries? => break
-            if (buf_idx == max_entries)
-                break;
+        //read until chunk's end or max entries, column by column
+        size_t n = std::min(chunk_num_rows_ - chunk_idx_, max_entries - buf_idx);
 
-            //fetch row data
+        if (n > 0)
+        {
             for (idx_t c = 0; c < np; ++c)
-                readers[ c ] (r, buf_idx);
+                readers[ c ] (chunk_idx_, buf_idx, n);
+
+            chunk_idx_ += n;
+            buf_idx    += n;
         }
 
         //fetch next chunk?
@@ -36,6 +36,9 @@
 class Buffer;
 class PropertyList;
 
+template <class T>
+class NullableVector;
+
 /**
  */
 class DuckDBExecResult : public DBExecResult
@@ -61,6 +64,7 @@ public:
     bool hasChunk() const; 
 
     static PropertyDataType dataTypeFromDuckDB(duckdb_type type);
+    static bool storesDataType(duckdb_type type, PropertyDataType dtype);
 
 private:
     friend class DuckDBPrepare;
@@ -72,6 +76,7 @@ private:
     void fetchVectors(std::vector<void*>& data_vectors,
                       std::vector<uint64_t*>& valid_vectors,
                       size_t num_cols);
+    bool columnTypesMatch(const PropertyList& properties) const;
 
     template <typename T>
     T read(idx_t col, idx_t row)
@@ -87,6 +92,28 @@ private:
         throw std::runtime_error("DuckDBResult: readVector: not implemented for type");
     }
 
+    /**
+     * Reads num_rows rows of a DuckDB data vector into the given buffer vector.
+     * Generic version reads row by row, fixed-width types are specialized to copy the whole range at once.
+     */
+    template <typename T>
+    void readVectorRange(NullableVector<T>& vec,
+                         void* v,
+                         uint64_t* validity,
+                         idx_t row0,
+                         size_t buf_idx0,
+                         size_t num_rows)
+    {
+        assert(result_valid_);
+
+        for (size_t i = 0; i < num_rows; ++i)
+        {
+            //validity might be null if all rows are valid
+            if (!validity || duckdb_validity_row_is_valid(validity, row0 + i))
+                vec.set(buf_idx0 + i, readVector<T>(v, row0 + i));
+        }
+    }
+
     mutable duckdb_result                      result_;
     mutable boost::optional<duckdb_data_chunk> chunk_;
     size_t                                     chunk_num_rows_ = 0;
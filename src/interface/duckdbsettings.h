@@ -46,4 +46,5 @@ struct DuckDBSettings
     SortOrder    sort_order_default = SortOrder::Ascending;
     unsigned int max_ram_gb         = 2;
     unsigned int num_threads        = 8;
+    bool         append_chunks      = true; // append buffers via data chunks instead of row-wise
 };
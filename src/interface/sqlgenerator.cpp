@@ -851,10 +851,14 @@ string SQLGenerator::getInsertDBUpdateStringBind(shared_ptr<Buffer> buffer,
 }
 
 /**
+ * Creates a bind statement updating all buffer properties except the key column, selected via the key column.
+ * The key column may be at any position in the buffer. If passed, bind_indexes receives the (1-based) bind index
+ * of each buffer property: the other properties in buffer order, the key column last.
  */
 string SQLGenerator::getCreateDBUpdateStringBind(shared_ptr<Buffer> buffer,
                                                  const string& key_col_name,
-                                                 string table_name)
+                                                 string table_name,
+                                                 std::vector<size_t>* bind_indexes)
 {
     assert(buffer);
     assert(table_name.size() > 0);
@@ -871,38 +875,45 @@ string SQLGenerator::getCreateDBUpdateStringBind(shared_ptr<Buffer> buffer,
 
     logdbg << "SQLGenerator: createDBUpdateStringBind: idvar name " << key_col_name;
 
-    ss << "UPDATE " << table_name << " SET ";
-
-    if (key_col_name != properties.at(size - 1).name())
+    if (!buffer->properties().hasProperty(key_col_name))
     {
-        logerr << "SQLGenerator::createDBUpdateStringBind: key_col_name '" << key_col_name
-               << "' not at last position, but '" << properties.at(size - 1).name() << "'";
+        logerr << "SQLGenerator::createDBUpdateStringBind: key_col_name '" << key_col_name << "' not in buffer";
 
         throw runtime_error(
-                    "SQLGenerator: createDBUpdateStringBind: key_col_name not at last position");
+                    "SQLGenerator: createDBUpdateStringBind: key_col_name not in buffer");
     }
 
+    if (size < 2)
+        throw runtime_error(
+                    "SQLGenerator: createDBUpdateStringBind: no properties to update");
+
+    if (bind_indexes)
+        bind_indexes->assign(size, size);
+
+    ss << "UPDATE " << table_name << " SET ";
+
+    size_t bind_idx = 0;
+
     for (unsigned int cnt = 0; cnt < size; cnt++)
     {
         if (key_col_name == properties.at(cnt).name())
-        {
-            if (cnt == size - 1)
-                continue;
-            else
-                throw runtime_error(
-                        "SQLGenerator: createDBUpdateStringBind: id var at other than last position " +
-                        to_string(cnt));
-        }
-        ss << properties.at(cnt).name() << "=";
+            continue; // bound last
 
-        ss << placeholder(cnt + 1);
+        ++bind_idx;
 
-        if (cnt != size - 2)
-        {
+        if (bind_idx > 1)
             ss << ", ";
-        }
+
+        ss << properties.at(cnt).name() << "=";
+
+        ss << placeholder(bind_idx);
+
+        if (bind_indexes)
+            bind_indexes->at(cnt) = bind_idx;
     }
 
+    assert(bind_idx == size - 1);
+
     ss << " WHERE " << key_col_name << "=";
 
     ss << placeholder(size);
@@ -49,7 +49,8 @@ public:
                                             std::string table_name);
     std::string getCreateDBUpdateStringBind(std::shared_ptr<Buffer> buffer,
                                             const std::string& key_col_name, 
-                                            std::string table_name);
+                                            std::string table_name,
+                                            std::vector<size_t>* bind_indexes = nullptr);
     std::string getUpdateTableFromTableStatement(const std::string& table_name_src,
                                                  const std::string& table_name_dst,
                                                  const std::vector<std::string>& col_names,
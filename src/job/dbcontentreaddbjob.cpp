@@ -45,6 +45,8 @@ DBContentReadDBJob::DBContentReadDBJob(DBInterface& db_interface, DBContent& dbc
     // always order by timestamp
     order_variable_ = &COMPASS::instance().dbContentManager().metaGetVariable(
                 dbcontent_.name(), DBContent::meta_var_timestamp_);
+
+    concurrent_read_ = db_interface_.readsConcurrently();
 }
 
 DBContentReadDBJob::~DBContentReadDBJob() {}
@@ -64,7 +66,7 @@ void DBContentReadDBJob::run_impl()
     start_time_ = boost::posix_time::microsec_clock::local_time();
 
     db_interface_.prepareRead(dbcontent_, read_list_, custom_filter_clause_,
-                              use_order_, order_variable_);
+                              use_order_, order_variable_, concurrent_read_);
 
     unsigned int cnt = 0;
 
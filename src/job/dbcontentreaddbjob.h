@@ -41,6 +41,7 @@ public:
     dbContent::VariableSet& readList() { return read_list_; }
 
     unsigned int rowCount() const;
+    bool concurrentRead() const { return concurrent_read_; }
 
 protected:
     virtual void run_impl();
@@ -53,6 +54,8 @@ protected:
     bool use_order_;
     dbContent::Variable* order_variable_;
 
+    bool concurrent_read_ {false}; // read on separate read connection, concurrently to other reads
+
     unsigned int row_count_{0};
     std::shared_ptr<Buffer> cached_buffer_;
 
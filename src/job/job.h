@@ -22,6 +22,7 @@
 #include "logger.h"
 
 #include <memory>
+#include <functional>
 
 //use std::async instead of QThreadPool
 //#define USE_ASYNC_JOBS
@@ -88,8 +89,21 @@ public:
         //set thread affinity
         job::setThreadAffinity(thread_affinity_, job_id_);
 
+        //copy callback, the job may be deleted as soon as run_impl() set the done flag
+        std::function<void()> finished_callback = finished_callback_;
+
         //invoke derived
         run_impl();
+
+        //inform about finished run (e.g. to wake up the job manager), must not access members anymore
+        if (finished_callback)
+            finished_callback();
+    }
+
+    // callback invoked from the executing thread after run_impl() returned
+    void setFinishedCallback(const std::function<void()>& callback)
+    {
+        finished_callback_ = callback;
     }
 
     void setJobID(size_t id)
@@ -188,4 +202,6 @@ protected:
 
     boost::optional<size_t> job_id_;
     job::ThreadAffinity     thread_affinity_;
+
+    std::function<void()>   finished_callback_;
 };
@@ -23,6 +23,8 @@
 #include <QCoreApplication>
 #include <QThreadPool>
 
+#include <algorithm>
+
 using namespace Utils;
 
 /*************************************************************************************
@@ -80,8 +82,11 @@ void JobManagerBase::addBlockingJob(std::shared_ptr<Job> job,
 
     job->setJobID(blocking_ids_++);
     job->setThreadAffinity(thread_affinity.has_value() ? thread_affinity.value() : thread_affinity_default_blocking_);
+    job->setFinishedCallback([ this ] { wakeUp(); });
 
     addBlockingJob_impl(job);
+
+    wakeUp();
 }
 
 /**
@@ -93,8 +98,11 @@ void JobManagerBase::addNonBlockingJob(std::shared_ptr<Job> job,
 
     job->setJobID(non_blocking_ids_++);
     job->setThreadAffinity(thread_affinity.has_value() ? thread_affinity.value() : thread_affinity_default_nonblocking_);
+    job->setFinishedCallback([ this ] { wakeUp(); });
 
     addNonBlockingJob_impl(job);
+
+    wakeUp();
 }
 
 /**
@@ -102,12 +110,32 @@ void JobManagerBase::addNonBlockingJob(std::shared_ptr<Job> job,
 void JobManagerBase::addDBJob(std::shared_ptr<Job> job,
                               const boost::optional<job::ThreadAffinity>& thread_affinity)
 {
-    logdbg << "JobManagerBase: addDBJob: " << job->name() << " num " << numDBJobs();
+    addDBJob(job, thread_affinity, false);
+}
+
+/**
+ */
+void JobManagerBase::addDBReadJob(std::shared_ptr<Job> job,
+                                  const boost::optional<job::ThreadAffinity>& thread_affinity)
+{
+    addDBJob(job, thread_affinity, true);
+}
+
+/**
+ */
+void JobManagerBase::addDBJob(std::shared_ptr<Job> job,
+                              const boost::optional<job::ThreadAffinity>& thread_affinity,
+                              bool concurrent_read)
+{
+    logdbg << "JobManagerBase: addDBJob: " << job->name() << " num " << numDBJobs() << " concurrent read " << concurrent_read;
 
     job->setJobID(db_ids_++);
     job->setThreadAffinity(thread_affinity.has_value() ? thread_affinity.value() : thread_affinity_default_db_);
+    job->setFinishedCallback([ this ] { wakeUp(); });
+
+    addDBJob_impl(job, concurrent_read);
 
-    addDBJob_impl(job);
+    wakeUp();
 
     //emit databaseBusy();
 }
@@ -133,6 +161,90 @@ unsigned int JobManagerBase::numJobs() const
     return numBlockingJobs() + numNonBlockingJobs() + numDBJobs(); 
 }
 
+/**
+ * Returns the current queue depths and the timing of all jobs finished since the last reset.
+ */
+JobManagerBase::Metrics JobManagerBase::metrics() const
+{
+    Metrics m;
+
+    m.num_blocking_jobs     = numBlockingJobs();
+    m.num_non_blocking_jobs = numNonBlockingJobs();
+    m.num_db_jobs           = numDBJobs();
+
+    std::lock_guard<std::mutex> lock(metrics_mutex_);
+
+    m.blocking     = lane_metrics_[ (int)JobLane::Blocking    ];
+    m.non_blocking = lane_metrics_[ (int)JobLane::NonBlocking ];
+    m.db           = lane_metrics_[ (int)JobLane::DB          ];
+
+    return m;
+}
+
+/**
+ */
+void JobManagerBase::resetMetrics()
+{
+    std::lock_guard<std::mutex> lock(metrics_mutex_);
+
+    for (auto& lm : lane_metrics_)
+        lm = LaneMetrics();
+}
+
+/**
+ * Called from the manager thread when a finished job is flushed.
+ */
+void JobManagerBase::addFinishedJobToMetrics(JobLane lane,
+                                             const boost::posix_time::ptime& time_added,
+                                             const boost::posix_time::ptime& time_started)
+{
+    if (time_added.is_not_a_date_time() || time_started.is_not_a_date_time())
+        return;
+
+    boost::posix_time::ptime time_finished = boost::posix_time::microsec_clock::local_time();
+
+    double wait_time = (time_started - time_added).total_microseconds() / 1e6;
+    double run_time  = (time_finished - time_started).total_microseconds() / 1e6;
+
+    std::lock_guard<std::mutex> lock(metrics_mutex_);
+
+    LaneMetrics& lm = lane_metrics_[ (int)lane ];
+
+    ++lm.num_finished;
+
+    lm.wait_time_sum += wait_time;
+    lm.wait_time_max  = std::max(lm.wait_time_max, wait_time);
+    lm.run_time_sum  += run_time;
+    lm.run_time_max   = std::max(lm.run_time_max, run_time);
+}
+
+/**
+ * Wakes up the manager thread, may be called from any thread.
+ */
+void JobManagerBase::wakeUp()
+{
+    {
+        std::lock_guard<std::mutex> lock(wakeup_mutex_);
+        wakeup_pending_ = true;
+    }
+
+    wakeup_condition_.notify_one();
+}
+
+/**
+ * Waits until woken up, a wake up which occured since the last wait returns immediately.
+ */
+void JobManagerBase::waitForWakeUp()
+{
+    int wait_time_ms = needsPolling() ? PollWaitTimeMS : FallbackWaitTimeMS;
+
+    std::unique_lock<std::mutex> lock(wakeup_mutex_);
+
+    wakeup_condition_.wait_for(lock, std::chrono::milliseconds(wait_time_ms), [ this ] { return wakeup_pending_; });
+
+    wakeup_pending_ = false;
+}
+
 /**
  * Creates thread if possible.
  *
@@ -169,16 +281,21 @@ void JobManagerBase::run()
 
         if (debug && numJobs() > 0)
         {
+            Metrics m = metrics();
+
             loginf << "JobManagerBase: run:" 
-                   << " blocking jobs " << numBlockingJobs() 
-                   << " non-blocking jobs " << numNonBlockingJobs() 
-                   << " db jobs " << numDBJobs();  
+                   << " blocking jobs " << m.num_blocking_jobs
+                   << " non-blocking jobs " << m.num_non_blocking_jobs
+                   << " db jobs " << m.num_db_jobs
+                   << " avg wait blocking " << String::doubleToStringPrecision(m.blocking.avgWaitTime(), 4)
+                   << " non-blocking " << String::doubleToStringPrecision(m.non_blocking.avgWaitTime(), 4)
+                   << " db " << String::doubleToStringPrecision(m.db.avgWaitTime(), 4);
         }
 
 //        if (!stop_requested_ && changed_ && !hasDBJobs())
 //            emit databaseIdle();
 
-        msleep(1);
+        waitForWakeUp();
 
 //        if ((boost::posix_time::microsec_clock::local_time() - log_time_).total_seconds() > 1)
 //        {
@@ -206,6 +323,8 @@ void JobManagerBase::shutdown()
 
     setJobsObsolete();
 
+    wakeUp();
+
     loginf << "JobManagerBase: shutdown: waiting on jobs to quit";
 
     while (hasAnyJobs())
@@ -244,7 +363,8 @@ void JobManagerAsync::AsyncJob::exec()
         return true; 
     });
 
-    is_running_ = true;
+    is_running_   = true;
+    time_started_ = boost::posix_time::microsec_clock::local_time();
 }
 
 /**
@@ -273,7 +393,8 @@ JobManagerAsync::~JobManagerAsync() = default;
 void JobManagerAsync::addBlockingJob_impl(std::shared_ptr<Job> job)
 {
     std::shared_ptr<AsyncJob> j(new AsyncJob);
-    j->job_ = job;
+    j->job_        = job;
+    j->time_added_ = boost::posix_time::microsec_clock::local_time();
 
     blocking_jobs_.push(j);  // only add, do not start
 }
@@ -283,7 +404,8 @@ void JobManagerAsync::addBlockingJob_impl(std::shared_ptr<Job> job)
 void JobManagerAsync::addNonBlockingJob_impl(std::shared_ptr<Job> job)
 {
     std::shared_ptr<AsyncJob> j(new AsyncJob);
-    j->job_ = job;
+    j->job_        = job;
+    j->time_added_ = boost::posix_time::microsec_clock::local_time();
 
     non_blocking_jobs_[job->name()].push(j);  // add and start
     j->exec();
@@ -291,10 +413,12 @@ void JobManagerAsync::addNonBlockingJob_impl(std::shared_ptr<Job> job)
 
 /**
  */
-void JobManagerAsync::addDBJob_impl(std::shared_ptr<Job> job)
+void JobManagerAsync::addDBJob_impl(std::shared_ptr<Job> job, bool concurrent_read)
 {
     std::shared_ptr<AsyncJob> j(new AsyncJob);
-    j->job_ = job;
+    j->job_             = job;
+    j->time_added_      = boost::posix_time::microsec_clock::local_time();
+    j->concurrent_read_ = concurrent_read;
 
     queued_db_jobs_.push(j);
 
@@ -319,7 +443,9 @@ bool JobManagerAsync::hasNonBlockingJobs() const
  */
 bool JobManagerAsync::hasDBJobs() const
 { 
-    return active_db_job_ || !queued_db_jobs_.empty(); 
+    std::lock_guard<std::mutex> lock(db_jobs_mutex_);
+
+    return !active_db_jobs_.empty() || next_db_job_ || !queued_db_jobs_.empty(); 
 }
 
 /**
@@ -345,7 +471,9 @@ unsigned int JobManagerAsync::numNonBlockingJobs() const
  */
 unsigned int JobManagerAsync::numDBJobs() const
 {
-    return active_db_job_ ? queued_db_jobs_.unsafe_size() + 1 : queued_db_jobs_.unsafe_size();
+    std::lock_guard<std::mutex> lock(db_jobs_mutex_);
+
+    return active_db_jobs_.size() + (next_db_job_ ? 1 : 0) + queued_db_jobs_.unsafe_size();
 }
 
 /**
@@ -371,6 +499,10 @@ void JobManagerAsync::handleBlockingJobs(bool debug)
                 loginf << "JobManagerAsync: run: blocking job " << active_blocking_job_->job_->name() << " emitted done ";
             }
 
+            addFinishedJobToMetrics(JobLane::Blocking,
+                                    active_blocking_job_->time_added_,
+                                    active_blocking_job_->time_started_);
+
             active_blocking_job_ = nullptr;
         }
     }
@@ -446,6 +578,7 @@ void JobManagerAsync::handleNonBlockingJobs(bool debug)
             }
 
             // otherwise (front_job->done()==true) -> we've removed it permanently
+            addFinishedJobToMetrics(JobLane::NonBlocking, front_job->time_added_, front_job->time_started_);
         }
 
         if (queue.empty())
@@ -459,39 +592,55 @@ void JobManagerAsync::handleNonBlockingJobs(bool debug)
  */
 void JobManagerAsync::handleDBJobs(bool debug)
 {
-    if (active_db_job_)  // see if active one exists
-    {
-        if (active_db_job_->done())
-        {
-//            if (active_db_job_->obsolete())
-//            {
-//                logdbg << "JobManagerAsync: run: flushing obsolete non-blocking job";
+    //flush done jobs
+    std::vector<AsyncJobPtr> done_jobs;
 
-//                if (!stop_requested_)
-//                    active_db_job_->emitObsolete();
-//            }
-
-            logdbg << "JobManagerAsync: run: flushing non-blocking done job";
+    {
+        std::lock_guard<std::mutex> lock(db_jobs_mutex_);
 
-            if (!stop_requested_)
+        for (auto it = active_db_jobs_.begin(); it != active_db_jobs_.end(); /*no increment here*/)
+        {
+            if ((*it)->done())
             {
-                active_db_job_->job_->emitDone();
-                logdbg << "JobManagerAsync: run: done non-blocking job emitted " + active_db_job_->job_->name();
+                done_jobs.push_back(*it);
+                it = active_db_jobs_.erase(it);
+            }
+            else
+            {
+                ++it;
             }
-
-            active_db_job_ = nullptr;
         }
     }
 
-    if (!active_db_job_ && !queued_db_jobs_.empty())
+    for (auto& done_job : done_jobs)
     {
-        if (queued_db_jobs_.try_pop(active_db_job_))
-        {
-            active_db_job_->exec();
+        logdbg << "JobManagerAsync: run: flushing db done job";
 
-            //changed_ = true;
-            //really_update_widget_ = !hasDBJobs();
+        if (!stop_requested_)
+        {
+            done_job->job_->emitDone();
+            logdbg << "JobManagerAsync: run: done db job emitted " + done_job->job_->name();
         }
+
+        addFinishedJobToMetrics(JobLane::DB,
+                                done_job->time_added_,
+                                done_job->time_started_);
+    }
+
+    //start queued jobs in order, either a single db job or multiple concurrent read jobs are active
+    std::lock_guard<std::mutex> lock(db_jobs_mutex_);
+
+    while (next_db_job_ || queued_db_jobs_.try_pop(next_db_job_))
+    {
+        bool can_start = active_db_jobs_.empty() ||
+                         (next_db_job_->concurrent_read_ && active_db_jobs_.front()->concurrent_read_);
+        if (!can_start)
+            break;
+
+        next_db_job_->exec();
+
+        active_db_jobs_.push_back(next_db_job_);
+        next_db_job_ = nullptr;
     }
 }
 
@@ -499,8 +648,15 @@ void JobManagerAsync::handleDBJobs(bool debug)
  */
 void JobManagerAsync::setJobsObsolete()
 {
-    if (active_db_job_)
-        active_db_job_->job_->setObsolete();
+    {
+        std::lock_guard<std::mutex> lock(db_jobs_mutex_);
+
+        for (auto& active_db_job : active_db_jobs_)
+            active_db_job->job_->setObsolete();
+
+        if (next_db_job_)
+            next_db_job_->job_->setObsolete();
+    }
 
     for (auto job_it = queued_db_jobs_.unsafe_begin(); job_it != queued_db_jobs_.unsafe_end();
          ++job_it)
@@ -531,6 +687,8 @@ void JobManagerThreadPool::AsyncJob::exec()
     assert (job_);
     assert (!is_running_);
 
+    time_started_ = boost::posix_time::microsec_clock::local_time();
+
     QThreadPool::globalInstance()->start(job_.get());
 
     is_running_ = true;
@@ -543,6 +701,8 @@ bool JobManagerThreadPool::AsyncJob::tryExec()
     assert (job_);
     assert (!is_running_);
 
+    time_started_ = boost::posix_time::microsec_clock::local_time();
+
     bool ok = QThreadPool::globalInstance()->tryStart(job_.get());
 
     is_running_ = ok;
@@ -581,7 +741,8 @@ JobManagerThreadPool::~JobManagerThreadPool() = default;
 void JobManagerThreadPool::addBlockingJob_impl(std::shared_ptr<Job> job)
 {
     std::shared_ptr<AsyncJob> j(new AsyncJob);
-    j->job_ = job;
+    j->job_        = job;
+    j->time_added_ = boost::posix_time::microsec_clock::local_time();
 
     blocking_jobs_.push(j);  // only add, do not start
 }
@@ -591,7 +752,8 @@ void JobManagerThreadPool::addBlockingJob_impl(std::shared_ptr<Job> job)
 void JobManagerThreadPool::addNonBlockingJob_impl(std::shared_ptr<Job> job)
 {
     std::shared_ptr<AsyncJob> j(new AsyncJob);
-    j->job_ = job;
+    j->job_        = job;
+    j->time_added_ = boost::posix_time::microsec_clock::local_time();
 
     //queue iterated regularly? => needs further protection
     if (!exec_nb_jobs_immediately_)
@@ -610,10 +772,12 @@ void JobManagerThreadPool::addNonBlockingJob_impl(std::shared_ptr<Job> job)
 
 /**
  */
-void JobManagerThreadPool::addDBJob_impl(std::shared_ptr<Job> job)
+void JobManagerThreadPool::addDBJob_impl(std::shared_ptr<Job> job, bool concurrent_read)
 {
     std::shared_ptr<AsyncJob> j(new AsyncJob);
-    j->job_ = job;
+    j->job_             = job;
+    j->time_added_      = boost::posix_time::microsec_clock::local_time();
+    j->concurrent_read_ = concurrent_read;
 
     queued_db_jobs_.push(j);
 }
@@ -636,7 +800,9 @@ bool JobManagerThreadPool::hasNonBlockingJobs() const
  */
 bool JobManagerThreadPool::hasDBJobs() const
 { 
-    return active_db_job_ || !queued_db_jobs_.empty(); 
+    std::lock_guard<std::mutex> lock(db_jobs_mutex_);
+
+    return !active_db_jobs_.empty() || next_db_job_ || !queued_db_jobs_.empty(); 
 }
 
 /**
@@ -658,7 +824,9 @@ unsigned int JobManagerThreadPool::numNonBlockingJobs() const
  */
 unsigned int JobManagerThreadPool::numDBJobs() const
 {
-    return active_db_job_ ? queued_db_jobs_.unsafe_size() + 1 : queued_db_jobs_.unsafe_size();
+    std::lock_guard<std::mutex> lock(db_jobs_mutex_);
+
+    return active_db_jobs_.size() + (next_db_job_ ? 1 : 0) + queued_db_jobs_.unsafe_size();
 }
 
 /**
@@ -693,6 +861,10 @@ void JobManagerThreadPool::handleBlockingJobs(bool debug)
                               active_blocking_job_->job_->name();
             }
 
+            addFinishedJobToMetrics(JobLane::Blocking,
+                                    active_blocking_job_->time_added_,
+                                    active_blocking_job_->time_started_);
+
             active_blocking_job_ = nullptr;
         }
     }
@@ -759,6 +931,8 @@ void JobManagerThreadPool::handleNonBlockingJobs(bool debug)
         num_total = num_started + num_waiting + num_running;
     }
 
+    num_non_blocking_waiting_ = num_waiting;
+
     if (debug && num_total > 0)
     {
         logdbg << "JobManagerThreadPool: handleNonBlockingJobs:"
@@ -790,6 +964,10 @@ void JobManagerThreadPool::handleNonBlockingJobs(bool debug)
                                   active_non_blocking_job_->job_->name();
                 }
 
+                addFinishedJobToMetrics(JobLane::NonBlocking,
+                                        active_non_blocking_job_->time_added_,
+                                        active_non_blocking_job_->time_started_);
+
                 active_non_blocking_job_ = nullptr;
             }
             else
@@ -821,49 +999,78 @@ void JobManagerThreadPool::handleNonBlockingJobs(bool debug)
  */
 void JobManagerThreadPool::handleDBJobs(bool debug)
 {
-    if (active_db_job_)  // see if active one exists
-    {
-        if (active_db_job_->done())
-        {
-//            if (active_db_job_->obsolete())
-//            {
-//                logdbg << "JobManagerThreadPool: run: flushing obsolete non-blocking job";
-
-//                if (!stop_requested_)
-//                    active_db_job_->emitObsolete();
-//            }
+    //flush done jobs
+    std::vector<AsyncJobPtr> done_jobs;
 
-            logdbg << "JobManagerThreadPool: run: flushing non-blocking done job";
+    {
+        std::lock_guard<std::mutex> lock(db_jobs_mutex_);
 
-            if (!stop_requested_)
+        for (auto it = active_db_jobs_.begin(); it != active_db_jobs_.end(); /*no increment here*/)
+        {
+            if ((*it)->done())
             {
-                active_db_job_->job_->emitDone();
-                logdbg << "JobManagerThreadPool: run: done non-blocking job emitted " +
-                              active_db_job_->job_->name();
+                done_jobs.push_back(*it);
+                it = active_db_jobs_.erase(it);
+            }
+            else
+            {
+                ++it;
             }
-
-            active_db_job_ = nullptr;
         }
     }
 
-    if (!active_db_job_ && !queued_db_jobs_.empty())
+    for (auto& done_job : done_jobs)
     {
-        if (queued_db_jobs_.try_pop(active_db_job_))
-        {
-            active_db_job_->exec();
+        logdbg << "JobManagerThreadPool: run: flushing db done job";
 
-            //changed_ = true;
-            //really_update_widget_ = !hasDBJobs();
+        if (!stop_requested_)
+        {
+            done_job->job_->emitDone();
+            logdbg << "JobManagerThreadPool: run: done db job emitted " + done_job->job_->name();
         }
+
+        addFinishedJobToMetrics(JobLane::DB,
+                                done_job->time_added_,
+                                done_job->time_started_);
     }
+
+    //start queued jobs in order, either a single db job or multiple concurrent read jobs are active
+    std::lock_guard<std::mutex> lock(db_jobs_mutex_);
+
+    while (next_db_job_ || queued_db_jobs_.try_pop(next_db_job_))
+    {
+        bool can_start = active_db_jobs_.empty() ||
+                         (next_db_job_->concurrent_read_ && active_db_jobs_.front()->concurrent_read_);
+        if (!can_start)
+            break;
+
+        next_db_job_->exec();
+
+        active_db_jobs_.push_back(next_db_job_);
+        next_db_job_ = nullptr;
+    }
+}
+
+/**
+ */
+bool JobManagerThreadPool::needsPolling() const
+{
+    return num_non_blocking_waiting_ > 0;
 }
 
 /**
  */
 void JobManagerThreadPool::setJobsObsolete()
 {
-    if (active_db_job_)
-        active_db_job_->job_->setObsolete();
+    {
+        std::lock_guard<std::mutex> lock(db_jobs_mutex_);
+
+        for (auto& active_db_job : active_db_jobs_)
+            active_db_job->job_->setObsolete();
+
+        if (next_db_job_)
+            next_db_job_->job_->setObsolete();
+    }
 
     for (auto job_it = queued_db_jobs_.unsafe_begin(); job_it != queued_db_jobs_.unsafe_end();
          ++job_it)
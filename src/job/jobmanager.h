@@ -32,16 +32,60 @@
 #include "util/tbbhack.h"
 
 #include <list>
+#include <vector>
 #include <memory>
 #include <future>
+#include <mutex>
+#include <condition_variable>
 
 class WorkerThread;
 
 /**
+ * Manages blocking, non-blocking and db jobs in a separate thread.
+ *
+ * The manager thread sleeps until woken up by an added or finished job (or a short fallback timeout),
+ * so that finished jobs are signalled without a polling delay and no cpu time is used when idle.
  */
 class JobManagerBase : public QThread
 {
 public:
+    enum class JobLane
+    {
+        Blocking = 0,
+        NonBlocking,
+        DB
+    };
+
+    /**
+     * Timing of finished jobs, wait time is from adding until start, run time from start
+     * until the job was noticed as done by the manager.
+     */
+    struct LaneMetrics
+    {
+        double avgWaitTime() const { return num_finished ? wait_time_sum / num_finished : 0.0; }
+        double avgRunTime() const { return num_finished ? run_time_sum / num_finished : 0.0; }
+
+        size_t num_finished  = 0;
+        double wait_time_sum = 0.0; // s
+        double wait_time_max = 0.0; // s
+        double run_time_sum  = 0.0; // s
+        double run_time_max  = 0.0; // s
+    };
+
+    /**
+     */
+    struct Metrics
+    {
+        // queue depths at time of query, including active jobs
+        unsigned int num_blocking_jobs     = 0;
+        unsigned int num_non_blocking_jobs = 0;
+        unsigned int num_db_jobs           = 0;
+
+        LaneMetrics blocking;
+        LaneMetrics non_blocking;
+        LaneMetrics db;
+    };
+
     JobManagerBase();
     virtual ~JobManagerBase();
 
@@ -54,6 +98,9 @@ public:
     // only one db job can be active
     void addDBJob(std::shared_ptr<Job> job,
                   const boost::optional<job::ThreadAffinity>& thread_affinity = boost::optional<job::ThreadAffinity>());
+    // may run concurrently with other db read jobs, but not with other db jobs, order of db jobs is kept
+    void addDBReadJob(std::shared_ptr<Job> job,
+                      const boost::optional<job::ThreadAffinity>& thread_affinity = boost::optional<job::ThreadAffinity>());
 
     void cancelJob(std::shared_ptr<Job> job);
 
@@ -71,12 +118,15 @@ public:
 
     virtual int numThreads() const = 0;
 
+    Metrics metrics() const;
+    void resetMetrics();
+
     void shutdown();
 
 protected:
     virtual void addBlockingJob_impl(std::shared_ptr<Job> job) = 0;
     virtual void addNonBlockingJob_impl(std::shared_ptr<Job> job) = 0;
-    virtual void addDBJob_impl(std::shared_ptr<Job> job) = 0;
+    virtual void addDBJob_impl(std::shared_ptr<Job> job, bool concurrent_read) = 0;
 
     virtual void handleBlockingJobs(bool debug) = 0;
     virtual void handleNonBlockingJobs(bool debug) = 0;
@@ -84,8 +134,18 @@ protected:
 
     virtual void setJobsObsolete() = 0;
 
+    // true if jobs wait for a resource which does not signal the manager (e.g. a free thread)
+    virtual bool needsPolling() const { return false; }
+
     void run();
 
+    void wakeUp();
+    void waitForWakeUp();
+
+    void addFinishedJobToMetrics(JobLane lane,
+                                 const boost::posix_time::ptime& time_added,
+                                 const boost::posix_time::ptime& time_started);
+
     void setDefaultThreadAffinity(const job::ThreadAffinity& thread_affinity);
     void setDefaultThreadAffinityBlocking(const job::ThreadAffinity& thread_affinity);
     void setDefaultThreadAffinityNonBlocking(const job::ThreadAffinity& thread_affinity);
@@ -97,6 +157,10 @@ protected:
     boost::posix_time::ptime last_update_time_;
 
 private:
+    void addDBJob(std::shared_ptr<Job> job,
+                  const boost::optional<job::ThreadAffinity>& thread_affinity,
+                  bool concurrent_read);
+
     size_t non_blocking_ids_ = 0;
     size_t blocking_ids_     = 0;
     size_t db_ids_           = 0;
@@ -104,6 +168,16 @@ private:
     job::ThreadAffinity thread_affinity_default_blocking_;
     job::ThreadAffinity thread_affinity_default_nonblocking_;
     job::ThreadAffinity thread_affinity_default_db_;
+
+    std::mutex              wakeup_mutex_;
+    std::condition_variable wakeup_condition_;
+    bool                    wakeup_pending_ = false;
+
+    mutable std::mutex metrics_mutex_;
+    LaneMetrics        lane_metrics_[ 3 ]; // index is JobLane
+
+    static const int PollWaitTimeMS     = 1;   // wait time if jobs wait on a free thread
+    static const int FallbackWaitTimeMS = 100; // wait time if no wake up occurs
 };
 
 /**
@@ -120,7 +194,11 @@ public:
 
         std::shared_ptr<Job> job_;
         std::future<bool>    future_;
-        bool                 is_running_ = false;
+        bool                 is_running_      = false;
+        bool                 concurrent_read_ = false; // db read job
+
+        boost::posix_time::ptime time_added_;
+        boost::posix_time::ptime time_started_;
     };
 
     typedef std::shared_ptr<AsyncJob> AsyncJobPtr;
@@ -141,7 +219,7 @@ public:
 protected:
     void addBlockingJob_impl(std::shared_ptr<Job> job) override;
     void addNonBlockingJob_impl(std::shared_ptr<Job> job) override;
-    void addDBJob_impl(std::shared_ptr<Job> job) override;
+    void addDBJob_impl(std::shared_ptr<Job> job, bool concurrent_read) override;
 
     void handleBlockingJobs(bool debug) override;
     void handleNonBlockingJobs(bool debug) override;
@@ -156,7 +234,9 @@ private:
     //AsyncJobPtr active_non_blocking_job_;
     tbb::concurrent_unordered_map<std::string,tbb::concurrent_queue<AsyncJobPtr>> non_blocking_jobs_;
 
-    AsyncJobPtr active_db_job_;
+    mutable std::mutex                 db_jobs_mutex_;  // protects active and next db jobs
+    std::vector<AsyncJobPtr>           active_db_jobs_; // a single db job or multiple concurrent read jobs
+    AsyncJobPtr                        next_db_job_;    // waiting for the active db jobs to finish
     tbb::concurrent_queue<AsyncJobPtr> queued_db_jobs_;
 };
 
@@ -174,7 +254,11 @@ public:
         bool done() const;
 
         std::shared_ptr<Job> job_;
-        bool                 is_running_ = false;
+        bool                 is_running_      = false;
+        bool                 concurrent_read_ = false; // db read job
+
+        boost::posix_time::ptime time_added_;
+        boost::posix_time::ptime time_started_;
     };
 
     typedef std::shared_ptr<AsyncJob> AsyncJobPtr;
@@ -195,7 +279,7 @@ public:
 protected:
     void addBlockingJob_impl(std::shared_ptr<Job> job) override;
     void addNonBlockingJob_impl(std::shared_ptr<Job> job) override;
-    void addDBJob_impl(std::shared_ptr<Job> job) override;
+    void addDBJob_impl(std::shared_ptr<Job> job, bool concurrent_read) override;
 
     void handleBlockingJobs(bool debug) override;
     void handleNonBlockingJobs(bool debug) override;
@@ -203,15 +287,21 @@ protected:
 
     void setJobsObsolete() override;
 
+    bool needsPolling() const override;
+
 private:
     AsyncJobPtr active_blocking_job_;
     tbb::concurrent_queue<AsyncJobPtr> blocking_jobs_;
 
+    size_t num_non_blocking_waiting_ = 0; // postponed jobs waiting for a free thread
+
     boost::mutex non_blocking_queue_mutex_;
     AsyncJobPtr active_non_blocking_job_;
     tbb::concurrent_queue<AsyncJobPtr> non_blocking_jobs_;
 
-    AsyncJobPtr active_db_job_;
+    mutable std::mutex                 db_jobs_mutex_;  // protects active and next db jobs
+    std::vector<AsyncJobPtr>           active_db_jobs_; // a single db job or multiple concurrent read jobs
+    AsyncJobPtr                        next_db_job_;    // waiting for the active db jobs to finish
     tbb::concurrent_queue<AsyncJobPtr> queued_db_jobs_;
 
     // if true non-blocking jobs will be executed immediately on add,
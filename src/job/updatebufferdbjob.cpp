@@ -27,6 +27,9 @@
 
 using namespace Utils::String;
 
+// large chunks, so that bulk updates via temporary tables are not split up too much
+const unsigned int UpdateBufferDBJob::UpdateChunkSize = 500000;
+
 UpdateBufferDBJob::UpdateBufferDBJob(DBInterface& db_interface, DBContent& dbobject,
                                      dbContent::Variable& key_var, std::shared_ptr<Buffer> buffer)
     : Job("UpdateBufferDBJob"),
@@ -52,7 +55,7 @@ void UpdateBufferDBJob::run_impl()
 
     loading_start_time_ = boost::posix_time::microsec_clock::local_time();
 
-    unsigned int steps = buffer_->size() / 10000;
+    unsigned int steps = buffer_->size() / UpdateChunkSize;
 
     logdbg << "UpdateBufferDBJob: run: writing object " << dbobject_.name() << " key "
            << key_var_.name() << " size " << buffer_->size() << " steps " << steps;
@@ -62,8 +65,12 @@ void UpdateBufferDBJob::run_impl()
 
     for (unsigned int cnt = 0; cnt <= steps; cnt++)
     {
-        index_from = cnt * 10000;
-        index_to = index_from + 10000;
+        index_from = cnt * UpdateChunkSize;
+
+        if (index_from >= buffer_->size())
+            break;
+
+        index_to = index_from + UpdateChunkSize - 1; // inclusive
 
         if (index_to > buffer_->size() - 1)
             index_to = buffer_->size() - 1;
@@ -51,6 +51,8 @@ class UpdateBufferDBJob : public Job
         return buffer_;
     }
 
+    static const unsigned int UpdateChunkSize; // rows per update statement
+
   protected:
     virtual void run_impl();
 
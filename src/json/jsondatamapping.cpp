@@ -362,9 +362,17 @@ bool JSONDataMapping::findAndSetValue(const json& j, NullableVector<T>& array_li
                                       size_t row_cnt, bool debug) const
 {
     if (in_array_)
-    {
-        const json* val_ptr = findParentKey(j);
+        return setFoundValue(findParentKey(j), array_list, row_cnt, debug);
+    else
+        return setFoundValue(findKey(j), array_list, row_cnt, debug);
+}
 
+template <typename T>
+bool JSONDataMapping::setFoundValue(const json* val_ptr, NullableVector<T>& array_list,
+                                    size_t row_cnt, bool debug) const
+{
+    if (in_array_)
+    {
         if (val_ptr == nullptr || *val_ptr == nullptr)
         {
             if (mandatory_)
@@ -410,8 +418,6 @@ bool JSONDataMapping::findAndSetValue(const json& j, NullableVector<T>& array_li
     }
     else
     {
-        const json* val_ptr = findKey(j);
-
         if (val_ptr == nullptr || *val_ptr == nullptr)
         {
             if (mandatory_)
@@ -481,6 +487,37 @@ size_t row_cnt, bool debug) const;
 //NullableVector<json>& array_list,
 //size_t row_cnt, bool debug) const;
 
+template bool JSONDataMapping::setFoundValue(const json* val_ptr,
+NullableVector<bool>& array_list,
+size_t row_cnt, bool debug) const;
+template bool JSONDataMapping::setFoundValue(const json* val_ptr,
+NullableVector<char>& array_list,
+size_t row_cnt, bool debug) const;
+template bool JSONDataMapping::setFoundValue(const json* val_ptr,
+NullableVector<unsigned char>& array_list,
+size_t row_cnt, bool debug) const;
+template bool JSONDataMapping::setFoundValue(const json* val_ptr,
+NullableVector<int>& array_list,
+size_t row_cnt, bool debug) const;
+template bool JSONDataMapping::setFoundValue(const json* val_ptr,
+NullableVector<unsigned int>& array_list,
+size_t row_cnt, bool debug) const;
+template bool JSONDataMapping::setFoundValue(const json* val_ptr,
+NullableVector<long int>& array_list,
+size_t row_cnt, bool debug) const;
+template bool JSONDataMapping::setFoundValue(const json* val_ptr,
+NullableVector<unsigned long int>& array_list,
+size_t row_cnt, bool debug) const;
+template bool JSONDataMapping::setFoundValue(const json* val_ptr,
+NullableVector<float>& array_list,
+size_t row_cnt, bool debug) const;
+template bool JSONDataMapping::setFoundValue(const json* val_ptr,
+NullableVector<double>& array_list,
+size_t row_cnt, bool debug) const;
+template bool JSONDataMapping::setFoundValue(const json* val_ptr,
+NullableVector<std::string>& array_list,
+size_t row_cnt, bool debug) const;
+
 bool JSONDataMapping::findAndSetValues(const json& j, NullableVector<json>& array_list,
                      size_t row_cnt, bool debug) const
 {
@@ -522,6 +559,21 @@ bool JSONDataMapping::findAndSetValues(const json& j, NullableVector<json>& arra
     }
 }
 
+bool JSONDataMapping::hasValueKeyPath() const
+{
+    return sub_keys_.size();
+}
+
+std::vector<std::string> JSONDataMapping::valueKeyPath() const
+{
+    assert (hasValueKeyPath());
+
+    if (in_array_) // parent key path, empty if top-level
+        return std::vector<std::string>(sub_keys_.begin(), sub_keys_.end() - 1);
+
+    return sub_keys_;
+}
+
 const json* JSONDataMapping::findKey(const json& j) const
 {
     const json* val_ptr = &j;
@@ -52,6 +52,11 @@ class JSONDataMapping : public Configurable
     template <typename T>
     bool findAndSetValue(const nlohmann::json& j, NullableVector<T>& array_list,
                          size_t row_cnt, bool debug=false) const;
+    // sets value as returned by the key lookup, i.e. the parent value for in-array mappings
+    // return bool mandatory missing
+    template <typename T>
+    bool setFoundValue(const nlohmann::json* val_ptr, NullableVector<T>& array_list,
+                       size_t row_cnt, bool debug=false) const;
     // only used for lists ending up as JSON
     bool findAndSetValues(const nlohmann::json& j, NullableVector<nlohmann::json>& array_list,
                          size_t row_cnt, bool debug=false) const;
@@ -68,6 +73,10 @@ class JSONDataMapping : public Configurable
     const std::string& jsonKey() const;
     void jsonKey(const std::string& json_key);
 
+    // key path of the value passed to setFoundValue, parent key path for in-array mappings
+    bool hasValueKeyPath() const;
+    std::vector<std::string> valueKeyPath() const;
+
     bool active() const;
     void active(bool active);
     bool canBeActive() const;
@@ -0,0 +1,231 @@
+/*
+ * This file is part of OpenATS COMPASS.
+ *
+ * COMPASS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * COMPASS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with COMPASS. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "jsonmappingplan.h"
+#include "jsondatamapping.h"
+#include "buffer.h"
+#include "dbcontent/variable/variable.h"
+#include "logger.h"
+
+#include "json.hpp"
+
+#include <algorithm>
+
+using namespace std;
+using namespace nlohmann;
+
+JSONMappingPlan::JSONMappingPlan(const std::vector<std::unique_ptr<JSONDataMapping>>& mappings,
+                                 Buffer& buffer)
+    : buffer_(buffer)
+{
+    nodes_.emplace_back(); // root
+
+    for (const auto& map_it : mappings)
+    {
+        if (!map_it->active())
+        {
+            assert(!map_it->mandatory());
+            continue;
+        }
+
+        const dbContent::Variable& variable = map_it->variable();
+
+        PropertyDataType data_type = variable.dataType();
+        const string& var_name = variable.name();
+
+        switch (data_type)
+        {
+        case PropertyDataType::BOOL:
+            addEntry<bool>(*map_it, var_name);
+            break;
+        case PropertyDataType::CHAR:
+            addEntry<char>(*map_it, var_name);
+            break;
+        case PropertyDataType::UCHAR:
+            addEntry<unsigned char>(*map_it, var_name);
+            break;
+        case PropertyDataType::INT:
+            addEntry<int>(*map_it, var_name);
+            break;
+        case PropertyDataType::UINT:
+            addEntry<unsigned int>(*map_it, var_name);
+            break;
+        case PropertyDataType::LONGINT:
+            addEntry<long int>(*map_it, var_name);
+            break;
+        case PropertyDataType::ULONGINT:
+            addEntry<unsigned long>(*map_it, var_name);
+            break;
+        case PropertyDataType::FLOAT:
+            addEntry<float>(*map_it, var_name);
+            break;
+        case PropertyDataType::DOUBLE:
+            addEntry<double>(*map_it, var_name);
+            break;
+        case PropertyDataType::STRING:
+            addEntry<std::string>(*map_it, var_name);
+            break;
+        case PropertyDataType::JSON: // only to be used for lists
+            addJSONEntry(*map_it, var_name);
+            break;
+        case PropertyDataType::TIMESTAMP: // not possible for timestamp
+        default:
+            logerr << "JSONMappingPlan: ctor: impossible for property type "
+                   << Property::asString(data_type);
+            throw std::runtime_error("JSONMappingPlan: ctor: impossible property type " +
+                                     Property::asString(data_type));
+        }
+    }
+
+    node_values_.resize(nodes_.size(), nullptr);
+
+    logdbg << "JSONMappingPlan: ctor: buffer " << buffer_.dbContentName() << " entries " << entries_.size()
+           << " key nodes " << nodes_.size();
+}
+
+JSONMappingPlan::~JSONMappingPlan() = default;
+
+bool JSONMappingPlan::mapRecord(const nlohmann::json& j, size_t row_cnt) const
+{
+    // walk record once, resolving all shared key paths
+    std::fill(node_values_.begin(), node_values_.end(), nullptr);
+    resolveKeyNodes(0, &j);
+
+    bool mandatory_missing{false};
+
+    for (const auto& entry : entries_)
+    {
+        try
+        {
+            mandatory_missing = entry.set_func_(
+                j, entry.key_node_ >= 0 ? node_values_[entry.key_node_] : nullptr, row_cnt);
+        }
+        catch (exception& e)
+        {
+            logerr << "JSONMappingPlan: mapRecord: caught exception '" << e.what() << "' in \n'"
+                   << j.dump(4) << "' mapping " << entry.mapping_->jsonKey();
+            throw e;
+        }
+
+        if (mandatory_missing)
+        {
+            logdbg << "JSONMappingPlan: mapRecord: mandatory variable '" << entry.var_name_
+                   << "' missing in: \n" << j.dump(4);
+            break;
+        }
+    }
+
+    if (mandatory_missing)
+    {
+        // cleanup
+        if (buffer_.size() > row_cnt)
+            buffer_.cutToSize(row_cnt);
+    }
+
+    return !mandatory_missing;
+}
+
+int JSONMappingPlan::addKeyPath(const std::vector<std::string>& key_path)
+{
+    unsigned int node_index = 0;
+
+    for (const auto& key : key_path)
+    {
+        bool found = false;
+
+        for (auto child_index : nodes_.at(node_index).children_)
+        {
+            if (nodes_.at(child_index).key_ == key)
+            {
+                node_index = child_index;
+                found = true;
+                break;
+            }
+        }
+
+        if (!found)
+        {
+            nodes_.emplace_back();
+            nodes_.back().key_ = key;
+
+            nodes_.at(node_index).children_.push_back(nodes_.size() - 1);
+            node_index = nodes_.size() - 1;
+        }
+    }
+
+    return node_index;
+}
+
+void JSONMappingPlan::resolveKeyNodes(unsigned int node_index, const nlohmann::json* value) const
+{
+    // same semantics as JSONDataMapping::findKey, only objects are stepped into
+    node_values_[node_index] = value;
+
+    if (!value->is_object())
+        return;
+
+    for (auto child_index : nodes_[node_index].children_)
+    {
+        auto it = value->find(nodes_[child_index].key_);
+
+        if (it != value->end())
+            resolveKeyNodes(child_index, &it.value());
+    }
+}
+
+template <typename T>
+void JSONMappingPlan::addEntry(const JSONDataMapping& mapping, const std::string& var_name)
+{
+    assert(buffer_.has<T>(var_name));
+
+    NullableVector<T>& column = buffer_.get<T>(var_name);
+    const JSONDataMapping* mapping_ptr = &mapping;
+
+    if (mapping.hasValueKeyPath())
+    {
+        entries_.push_back({mapping_ptr, var_name, addKeyPath(mapping.valueKeyPath()),
+                            [mapping_ptr, &column] (const nlohmann::json& j, const nlohmann::json* val_ptr,
+                                                    size_t row_cnt) {
+                                return mapping_ptr->setFoundValue(val_ptr, column, row_cnt);
+                            }});
+    }
+    else
+    {
+        entries_.push_back({mapping_ptr, var_name, -1,
+                            [mapping_ptr, &column] (const nlohmann::json& j, const nlohmann::json* val_ptr,
+                                                    size_t row_cnt) {
+                                return mapping_ptr->findAndSetValue(j, column, row_cnt);
+                            }});
+    }
+}
+
+void JSONMappingPlan::addJSONEntry(const JSONDataMapping& mapping, const std::string& var_name)
+{
+    assert(buffer_.has<json>(var_name));
+
+    NullableVector<json>& column = buffer_.get<json>(var_name);
+    const JSONDataMapping* mapping_ptr = &mapping;
+
+    // lists step into arrays, so are looked up by the mapping itself
+    // lists never count as mandatory missing, as in the generic parsing
+    entries_.push_back({mapping_ptr, var_name, -1,
+                        [mapping_ptr, &column] (const nlohmann::json& j, const nlohmann::json* val_ptr,
+                                                size_t row_cnt) {
+                            mapping_ptr->findAndSetValues(j, column, row_cnt);
+                            return false;
+                        }});
+}
@@ -0,0 +1,88 @@
+/*
+ * This file is part of OpenATS COMPASS.
+ *
+ * COMPASS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * COMPASS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with COMPASS. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "json_fwd.hpp"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+class Buffer;
+class JSONDataMapping;
+
+/**
+ * Mapping plan compiled from the active data mappings of a parser for one target buffer.
+ *
+ * Variable lookups, data type dispatching and buffer column resolution are done once on
+ * construction, so that mapping a record only calls the pre-bound column setters, which write
+ * directly into the NullableVectors of the buffer. Mappings are applied in the same order
+ * and with the same semantics as in the parsers' generic per-record paths.
+ *
+ * The key paths of all mappings are merged into a trie, so that key prefixes shared between
+ * mappings (e.g. "I040.MODEC" for several sub-items) are looked up only once per record.
+ *
+ * The plan holds references into the buffer, so the buffer's properties must not be changed
+ * while the plan is in use. Mapping is not thread-safe, one plan should be used per job.
+ */
+class JSONMappingPlan
+{
+public:
+    JSONMappingPlan(const std::vector<std::unique_ptr<JSONDataMapping>>& mappings, Buffer& buffer);
+    virtual ~JSONMappingPlan();
+
+    // returns true on successful parse, false if a mandatory value was missing
+    bool mapRecord(const nlohmann::json& j, size_t row_cnt) const;
+
+    Buffer& buffer() { return buffer_; }
+    const Buffer& buffer() const { return buffer_; }
+    size_t numEntries() const { return entries_.size(); }
+    size_t numKeyNodes() const { return nodes_.size(); }
+
+private:
+    struct KeyNode
+    {
+        std::string key_;
+        std::vector<unsigned int> children_;
+    };
+
+    struct Entry
+    {
+        const JSONDataMapping* mapping_ {nullptr};
+        std::string var_name_;
+        int key_node_ {-1}; // -1 if value has to be looked up by mapping itself
+
+        // (record, resolved value, row) returns true if mandatory value missing
+        std::function<bool(const nlohmann::json&, const nlohmann::json*, size_t)> set_func_;
+    };
+
+    Buffer& buffer_;
+
+    std::vector<KeyNode> nodes_; // index 0 is record root
+    std::vector<Entry> entries_;
+
+    mutable std::vector<const nlohmann::json*> node_values_; // per record, index as nodes_
+
+    int addKeyPath(const std::vector<std::string>& key_path);
+    void resolveKeyNodes(unsigned int node_index, const nlohmann::json* value) const;
+
+    template <typename T>
+    void addEntry(const JSONDataMapping& mapping, const std::string& var_name);
+    void addJSONEntry(const JSONDataMapping& mapping, const std::string& var_name);
+};
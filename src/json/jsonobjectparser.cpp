@@ -19,6 +19,7 @@
 
 #include "compass.h"
 #include "buffer.h"
+#include "jsonmappingplan.h"
 #include "configuration.h"
 #include "dbcontent/dbcontent.h"
 #include "dbcontent/dbcontentmanager.h"
@@ -265,8 +266,59 @@ void JSONObjectParser::createMappingStubs(nlohmann::json& j)
     return;
 }
 
-bool JSONObjectParser::parseTargetReport(const nlohmann::json& tr, Buffer& buffer,
-                                         size_t row_cnt) const
+bool JSONObjectParser::parseJSON(nlohmann::json& j, const JSONMappingPlan& plan) const
+{
+    assert(initialized_);
+
+    size_t row_cnt = plan.buffer().size();
+
+    bool parsed_any = false;
+
+    if (json_container_key_.size())
+    {
+        bool parsed = false;
+
+        if (j.contains(json_container_key_))
+        {
+            json& ac_list = j.at(json_container_key_);
+            assert(ac_list.is_array());
+
+            for (auto tr_it = ac_list.begin(); tr_it != ac_list.end(); ++tr_it)
+            {
+                json& tr = tr_it.value();
+                assert(tr.is_object());
+
+                parsed = parseTargetReport(tr, plan, row_cnt);
+
+                if (parsed)
+                    ++row_cnt;
+
+                parsed_any |= parsed;
+            }
+        }
+        else  // parsed stays false
+            loginf << "JSONObjectParser: parseJSON: found target report array but '"
+                   << json_container_key_ << "' not found";
+    }
+    else
+    {
+        logdbg << "JSONObjectParser: parseJSON: found single target report, mapping plan";
+        assert(j.is_object());
+
+        parsed_any = parseTargetReport(j, plan, row_cnt);
+    }
+
+    return parsed_any;
+}
+
+std::unique_ptr<JSONMappingPlan> JSONObjectParser::createMappingPlan(Buffer& buffer) const
+{
+    assert(initialized_);
+
+    return std::unique_ptr<JSONMappingPlan>(new JSONMappingPlan(data_mappings_, buffer));
+}
+
+bool JSONObjectParser::targetReportSelected(const nlohmann::json& tr) const
 {
     // check key match
     if (not_parse_all_)
@@ -276,21 +328,39 @@ bool JSONObjectParser::parseTargetReport(const nlohmann::json& tr, Buffer& buffe
             if (std::find(json_values_vector_.begin(), json_values_vector_.end(),
                           Utils::JSON::toString(tr.at(json_key_))) == json_values_vector_.end())
             {
-                logdbg << "JSONObjectParser: parseTargetReport: skipping because of wrong key "
+                logdbg << "JSONObjectParser: targetReportSelected: skipping because of wrong key "
                        << tr.at(json_key_) << " value " << Utils::JSON::toString(tr.at(json_key_));
                 return false;
             }
             else
-                logdbg << "JSONObjectParser: parseTargetReport: parsing with correct key and value";
+                logdbg << "JSONObjectParser: targetReportSelected: parsing with correct key and value";
         }
         else
         {
-            logdbg << "JSONObjectParser: parseTargetReport: skipping because of missing key '"
+            logdbg << "JSONObjectParser: targetReportSelected: skipping because of missing key '"
                    << json_key_ << "'";
             return false;
         }
     }
 
+    return true;
+}
+
+bool JSONObjectParser::parseTargetReport(const nlohmann::json& tr, const JSONMappingPlan& plan,
+                                         size_t row_cnt) const
+{
+    if (!targetReportSelected(tr))
+        return false;
+
+    return plan.mapRecord(tr, row_cnt);
+}
+
+bool JSONObjectParser::parseTargetReport(const nlohmann::json& tr, Buffer& buffer,
+                                         size_t row_cnt) const
+{
+    if (!targetReportSelected(tr))
+        return false;
+
     PropertyDataType data_type;
     std::string current_var_name;
 
@@ -32,6 +32,7 @@
 
 class Buffer;
 class DBContent;
+class JSONMappingPlan;
 
 namespace dbContent {
 
@@ -67,6 +68,9 @@ class JSONObjectParser : public Configurable
 
     // returs true on successful parse
     bool parseJSON(nlohmann::json& j, Buffer& buffer) const;
+    // returs true on successful parse, uses pre-resolved buffer columns of plan
+    bool parseJSON(nlohmann::json& j, const JSONMappingPlan& plan) const;
+    std::unique_ptr<JSONMappingPlan> createMappingPlan(Buffer& buffer) const;
     void createMappingStubs(nlohmann::json& j);
 
     const dbContent::VariableSet& variableList() const;
@@ -130,6 +134,9 @@ private:
 
     // returns true on successful parse
     bool parseTargetReport(const nlohmann::json& tr, Buffer& buffer, size_t row_cnt) const;
+    bool parseTargetReport(const nlohmann::json& tr, const JSONMappingPlan& plan, size_t row_cnt) const;
+    // returns true if target report has the configured key value (or all are parsed)
+    bool targetReportSelected(const nlohmann::json& tr) const;
     void createMappingsFromTargetReport(const nlohmann::json& tr);
 
     void checkIfKeysExistsInMappings(const std::string& location, const nlohmann::json& tr,
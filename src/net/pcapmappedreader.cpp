@@ -0,0 +1,547 @@
+/*
+ * This file is part of OpenATS COMPASS.
+ *
+ * COMPASS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * COMPASS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with COMPASS. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pcapmappedreader.h"
+#include "logger.h"
+#include "files.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+
+namespace
+{
+    const uint32_t PCAPMagicMicro        = 0xa1b2c3d4;
+    const uint32_t PCAPMagicNano         = 0xa1b23c4d;
+    const uint32_t PCAPNGSectionHeader   = 0x0a0d0d0a;
+    const uint32_t PCAPNGByteOrderMagic  = 0x1a2b3c4d;
+    const uint32_t PCAPNGInterfaceDesc   = 0x00000001;
+    const uint32_t PCAPNGSimplePacket    = 0x00000003;
+    const uint32_t PCAPNGEnhancedPacket  = 0x00000006;
+
+    const size_t PCAPGlobalHeaderSize = 24;
+    const size_t PCAPRecordHeaderSize = 16;
+
+    const int LinkTypeEthernet = 1;   // DLT_EN10MB
+    const int LinkTypeLinuxSLL = 113; // DLT_LINUX_SLL
+
+    const size_t   EthernetHeaderSize = 14;
+    const size_t   LinuxSLLHeaderSize = 16;
+    const uint16_t EtherTypeIPv4      = 0x0800;
+
+    const unsigned int IPProtocolTCP = 6;
+    const unsigned int IPProtocolUDP = 17;
+
+    const size_t UDPHeaderSize = 8;
+
+    uint16_t readBE16(const unsigned char* p) { return (uint16_t)((p[0] << 8) | p[1]); }
+    uint32_t readBE32(const unsigned char* p) { return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3]; }
+}
+
+/**
+*/
+PCAPMappedReader::PCAPMappedReader() = default;
+
+/**
+*/
+PCAPMappedReader::~PCAPMappedReader()
+{
+    close();
+}
+
+/**
+*/
+void PCAPMappedReader::close()
+{
+    if (data_)
+    {
+        munmap((void*)data_, size_);
+        data_ = nullptr;
+    }
+
+    if (fd_ >= 0)
+    {
+        ::close(fd_);
+        fd_ = -1;
+    }
+
+    size_           = 0;
+    pos_            = 0;
+    advised_until_  = 0;
+    released_until_ = 0;
+    link_type_      = -1;
+    swapped_        = false;
+
+    interface_link_types_.clear();
+
+    num_read_    = 0;
+    num_dropped_ = 0;
+    bytes_read_  = 0;
+}
+
+/**
+ * Maps the file and parses the file header, returns false if the file could not be mapped or has an unknown format.
+ */
+bool PCAPMappedReader::open(const std::string& fn)
+{
+    close();
+
+    std::string filename = Utils::Files::getFilenameFromPath(fn);
+
+    fd_ = ::open(fn.c_str(), O_RDONLY);
+
+    if (fd_ < 0)
+    {
+        logerr << "PCAPMappedReader: open: could not open file '" << filename << "'";
+        return false;
+    }
+
+    struct stat st;
+
+    if (fstat(fd_, &st) != 0 || st.st_size < (off_t)PCAPGlobalHeaderSize)
+    {
+        logerr << "PCAPMappedReader: open: file '" << filename << "' too small";
+        close();
+        return false;
+    }
+
+    size_ = st.st_size;
+
+    void* ptr = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+
+    if (ptr == MAP_FAILED)
+    {
+        logerr << "PCAPMappedReader: open: could not map file '" << filename << "'";
+        size_ = 0;
+        close();
+        return false;
+    }
+
+    data_ = (const unsigned char*)ptr;
+
+    madvise((void*)data_, size_, MADV_SEQUENTIAL);
+
+    uint32_t magic;
+    memcpy(&magic, data_, 4);
+
+    if (magic == PCAPMagicMicro || magic == PCAPMagicNano ||
+        __builtin_bswap32(magic) == PCAPMagicMicro || __builtin_bswap32(magic) == PCAPMagicNano)
+    {
+        format_   = Format::PCAP;
+        swapped_  = magic != PCAPMagicMicro && magic != PCAPMagicNano;
+        link_type_ = (int)(read32(20) & 0xFFFF);
+        pos_      = PCAPGlobalHeaderSize;
+    }
+    else if (magic == PCAPNGSectionHeader)
+    {
+        format_ = Format::PCAPNG;
+
+        if (!parsePCAPNGSectionHeader(0))
+        {
+            logerr << "PCAPMappedReader: open: invalid pcapng section header in '" << filename << "'";
+            close();
+            return false;
+        }
+
+        pos_ = 0; // section header is read as a normal block
+    }
+    else
+    {
+        logerr << "PCAPMappedReader: open: unknown file format in '" << filename << "'";
+        close();
+        return false;
+    }
+
+    adviseReadAhead();
+
+    loginf << "PCAPMappedReader: open: mapped " << (format_ == Format::PCAP ? "pcap" : "pcapng")
+           << " file '" << filename << "' size " << size_;
+
+    return true;
+}
+
+/**
+*/
+bool PCAPMappedReader::readNext(std::vector<char>& chunk,
+                                size_t max_bytes,
+                                const std::set<PacketSniffer::Signature>& signatures_to_read,
+                                bool& eof)
+{
+    eof = false;
+
+    if (!data_)
+    {
+        logerr << "PCAPMappedReader: readNext: no file opened";
+        return false;
+    }
+
+    std::set<BinarySignature> signatures;
+
+    for (const auto& sig : signatures_to_read)
+    {
+        BinarySignature bin_sig;
+
+        if (!toBinarySignature(sig, bin_sig))
+        {
+            logerr << "PCAPMappedReader: readNext: invalid signature " << PacketSniffer::signatureToString(sig);
+            return false;
+        }
+
+        signatures.insert(bin_sig);
+    }
+
+    size_t chunk_start_size = chunk.size();
+
+    Packet packet;
+    BinarySignature signature;
+    const unsigned char* data;
+    size_t data_len;
+
+    while (chunk.size() - chunk_start_size < max_bytes)
+    {
+        if (!readNextPacket(packet, eof))
+            return false;
+
+        if (eof)
+            break;
+
+        if (!payload(packet, signature, data, data_len))
+        {
+            ++num_dropped_;
+            continue;
+        }
+
+        if (!signatures.empty() && !signatures.count(signature))
+            continue;
+
+        chunk.insert(chunk.end(), (const char*)data, (const char*)data + data_len);
+
+        ++num_read_;
+        bytes_read_ += data_len;
+    }
+
+    adviseReadAhead();
+
+    return true;
+}
+
+/**
+*/
+bool PCAPMappedReader::readNextPacket(Packet& packet, bool& eof)
+{
+    if (format_ == Format::PCAP)
+        return readNextPCAPPacket(packet, eof);
+
+    return readNextPCAPNGPacket(packet, eof);
+}
+
+/**
+*/
+bool PCAPMappedReader::readNextPCAPPacket(Packet& packet, bool& eof)
+{
+    if (pos_ + PCAPRecordHeaderSize > size_)
+    {
+        eof = true;
+        return true;
+    }
+
+    size_t cap_len = read32(pos_ + 8);
+
+    if (pos_ + PCAPRecordHeaderSize + cap_len > size_)
+    {
+        // truncated last record, as written by interrupted recordings
+        logwrn << "PCAPMappedReader: readNextPCAPPacket: truncated record at " << pos_;
+        pos_ = size_;
+        eof = true;
+        return true;
+    }
+
+    packet.data      = data_ + pos_ + PCAPRecordHeaderSize;
+    packet.cap_len   = cap_len;
+    packet.link_type = link_type_;
+
+    pos_ += PCAPRecordHeaderSize + cap_len;
+
+    return true;
+}
+
+/**
+*/
+bool PCAPMappedReader::readNextPCAPNGPacket(Packet& packet, bool& eof)
+{
+    while (1)
+    {
+        if (pos_ + 12 > size_)
+        {
+            eof = true;
+            return true;
+        }
+
+        uint32_t block_type = read32(pos_);
+
+        if (block_type == PCAPNGSectionHeader && !parsePCAPNGSectionHeader(pos_))
+        {
+            logerr << "PCAPMappedReader: readNextPCAPNGPacket: invalid section header at " << pos_;
+            return false;
+        }
+
+        size_t block_len = read32(pos_ + 4);
+
+        if (block_len < 12 || block_len % 4 != 0)
+        {
+            logerr << "PCAPMappedReader: readNextPCAPNGPacket: invalid block length " << block_len << " at " << pos_;
+            return false;
+        }
+
+        if (pos_ + block_len > size_)
+        {
+            logwrn << "PCAPMappedReader: readNextPCAPNGPacket: truncated block at " << pos_;
+            pos_ = size_;
+            eof = true;
+            return true;
+        }
+
+        size_t block_pos = pos_;
+        pos_ += block_len;
+
+        if (block_type == PCAPNGInterfaceDesc)
+        {
+            interface_link_types_.push_back(read16(block_pos + 8));
+        }
+        else if (block_type == PCAPNGEnhancedPacket)
+        {
+            if (block_len < 32)
+                return false;
+
+            uint32_t interface_id = read32(block_pos + 8);
+            size_t   cap_len      = read32(block_pos + 20);
+
+            if (28 + cap_len > block_len - 4)
+            {
+                logerr << "PCAPMappedReader: readNextPCAPNGPacket: invalid packet length at " << block_pos;
+                return false;
+            }
+
+            packet.data      = data_ + block_pos + 28;
+            packet.cap_len   = cap_len;
+            packet.link_type = interface_id < interface_link_types_.size() ? interface_link_types_[interface_id] : -1;
+
+            return true;
+        }
+        else if (block_type == PCAPNGSimplePacket)
+        {
+            if (block_len < 16)
+                return false;
+
+            size_t orig_len = read32(block_pos + 8);
+
+            packet.data      = data_ + block_pos + 12;
+            packet.cap_len   = std::min(orig_len, block_len - 16);
+            packet.link_type = interface_link_types_.size() ? interface_link_types_[0] : -1;
+
+            return true;
+        }
+
+        // other blocks are skipped
+    }
+}
+
+/**
+*/
+bool PCAPMappedReader::parsePCAPNGSectionHeader(size_t block_pos)
+{
+    if (block_pos + 28 > size_)
+        return false;
+
+    uint32_t byte_order_magic;
+    memcpy(&byte_order_magic, data_ + block_pos + 8, 4);
+
+    if (byte_order_magic == PCAPNGByteOrderMagic)
+        swapped_ = false;
+    else if (__builtin_bswap32(byte_order_magic) == PCAPNGByteOrderMagic)
+        swapped_ = true;
+    else
+        return false;
+
+    // interfaces are defined per section
+    interface_link_types_.clear();
+
+    return true;
+}
+
+/**
+ * Returns the signature and payload of an ipv4 udp/tcp packet, false if the packet is not supported.
+ */
+bool PCAPMappedReader::payload(const Packet& packet,
+                               BinarySignature& signature,
+                               const unsigned char*& data,
+                               size_t& data_len)
+{
+    const unsigned char* p = packet.data;
+    size_t len = packet.cap_len;
+
+    size_t link_header_size;
+    uint16_t ether_type;
+
+    if (packet.link_type == LinkTypeEthernet)
+    {
+        if (len < EthernetHeaderSize)
+            return false;
+
+        ether_type = readBE16(p + 12);
+        link_header_size = EthernetHeaderSize;
+    }
+    else if (packet.link_type == LinkTypeLinuxSLL)
+    {
+        if (len < LinuxSLLHeaderSize)
+            return false;
+
+        ether_type = readBE16(p + 14);
+        link_header_size = LinuxSLLHeaderSize;
+    }
+    else
+    {
+        return false;
+    }
+
+    if (ether_type != EtherTypeIPv4)
+        return false;
+
+    p   += link_header_size;
+    len -= link_header_size;
+
+    if (len < 20)
+        return false;
+
+    size_t ip_header_size = (p[0] & 0x0F) * 4;
+    unsigned int ip_protocol = p[9];
+
+    if (ip_header_size < 20 || len < ip_header_size)
+        return false;
+
+    uint32_t src_ip = readBE32(p + 12);
+    uint32_t dst_ip = readBE32(p + 16);
+
+    p   += ip_header_size;
+    len -= ip_header_size;
+
+    if (ip_protocol == IPProtocolUDP)
+    {
+        if (len < UDPHeaderSize)
+            return false;
+
+        size_t udp_len = readBE16(p + 4);
+
+        if (udp_len < UDPHeaderSize)
+            return false;
+
+        signature = BinarySignature(src_ip, readBE16(p), dst_ip, readBE16(p + 2));
+
+        data     = p + UDPHeaderSize;
+        data_len = std::min(udp_len - UDPHeaderSize, len - UDPHeaderSize); // udp length drops padding
+    }
+    else if (ip_protocol == IPProtocolTCP)
+    {
+        if (len < 20)
+            return false;
+
+        size_t tcp_header_size = (p[12] >> 4) * 4;
+
+        if (tcp_header_size < 20 || len < tcp_header_size)
+            return false;
+
+        signature = BinarySignature(src_ip, readBE16(p), dst_ip, readBE16(p + 2));
+
+        data     = p + tcp_header_size;
+        data_len = len - tcp_header_size;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Reads ahead the next window and releases already processed pages.
+ */
+void PCAPMappedReader::adviseReadAhead()
+{
+    long page_size = sysconf(_SC_PAGESIZE);
+
+    if (advised_until_ < std::min(size_, pos_ + ReadAheadSize / 2))
+    {
+        size_t from = pos_ - pos_ % page_size;
+        size_t to   = std::min(size_, from + ReadAheadSize);
+
+        madvise((void*)(data_ + from), to - from, MADV_WILLNEED);
+
+        advised_until_ = to;
+    }
+
+    size_t release_until = pos_ - pos_ % page_size;
+
+    if (release_until > released_until_ + ReadAheadSize)
+    {
+        madvise((void*)(data_ + released_until_), release_until - released_until_, MADV_DONTNEED);
+
+        released_until_ = release_until;
+    }
+}
+
+/**
+*/
+uint16_t PCAPMappedReader::read16(size_t pos) const
+{
+    uint16_t v;
+    memcpy(&v, data_ + pos, 2);
+
+    return swapped_ ? __builtin_bswap16(v) : v;
+}
+
+/**
+*/
+uint32_t PCAPMappedReader::read32(size_t pos) const
+{
+    uint32_t v;
+    memcpy(&v, data_ + pos, 4);
+
+    return swapped_ ? __builtin_bswap32(v) : v;
+}
+
+/**
+*/
+bool PCAPMappedReader::toBinarySignature(const PacketSniffer::Signature& signature, BinarySignature& bin_signature)
+{
+    in_addr src_addr, dst_addr;
+
+    if (inet_pton(AF_INET, std::get<0>(signature).c_str(), &src_addr) != 1 ||
+        inet_pton(AF_INET, std::get<2>(signature).c_str(), &dst_addr) != 1)
+        return false;
+
+    bin_signature = BinarySignature(ntohl(src_addr.s_addr), std::get<1>(signature),
+                                    ntohl(dst_addr.s_addr), std::get<3>(signature));
+
+    return true;
+}
@@ -0,0 +1,117 @@
+/*
+ * This file is part of OpenATS COMPASS.
+ *
+ * COMPASS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * COMPASS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with COMPASS. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "packetsniffer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+/**
+ * Streaming reader for pcap and pcapng files, which maps the file into memory.
+ *
+ * Record, link layer, ip and udp/tcp headers are parsed in place in the mapped region, and packets are
+ * filtered by their binary signature, so that only the payloads of matching packets are touched and
+ * gathered into the chunk buffer passed to readNext(). Pages are read ahead sequentially and released
+ * behind the read position, so that memory usage stays bounded for large recordings.
+ *
+ * Supports the same link layer types and protocols as PacketSniffer (ethernet / linux cooked, ipv4, udp / tcp).
+ */
+class PCAPMappedReader
+{
+public:
+    PCAPMappedReader();
+    virtual ~PCAPMappedReader();
+
+    bool open(const std::string& fn);
+    void close();
+
+    bool isOpen() const { return data_ != nullptr; }
+
+    // appends payloads of packets matching the signatures (all if empty) to chunk until max_bytes are reached,
+    // returns false on parse errors
+    bool readNext(std::vector<char>& chunk,
+                  size_t max_bytes,
+                  const std::set<PacketSniffer::Signature>& signatures_to_read,
+                  bool& eof);
+
+    size_t fileSize() const { return size_; }
+    size_t position() const { return pos_; }
+
+    size_t numPacketsRead() const { return num_read_; }
+    size_t numPacketsDropped() const { return num_dropped_; }
+    size_t numBytesRead() const { return bytes_read_; }
+
+private:
+    typedef std::tuple<uint32_t, unsigned int, uint32_t, unsigned int> BinarySignature; // ips in host byte order
+
+    enum class Format
+    {
+        PCAP = 0,
+        PCAPNG
+    };
+
+    struct Packet
+    {
+        const unsigned char* data     = nullptr;
+        size_t               cap_len  = 0;
+        int                  link_type = -1;
+    };
+
+    static const size_t ReadAheadSize = 64 * 1024 * 1024;
+
+    bool readNextPacket(Packet& packet, bool& eof);
+    bool readNextPCAPPacket(Packet& packet, bool& eof);
+    bool readNextPCAPNGPacket(Packet& packet, bool& eof);
+
+    bool parsePCAPNGSectionHeader(size_t block_pos);
+
+    bool payload(const Packet& packet,
+                 BinarySignature& signature,
+                 const unsigned char*& data,
+                 size_t& data_len);
+
+    void adviseReadAhead();
+
+    uint16_t read16(size_t pos) const;
+    uint32_t read32(size_t pos) const;
+
+    static bool toBinarySignature(const PacketSniffer::Signature& signature, BinarySignature& bin_signature);
+
+    int                  fd_   = -1;
+    const unsigned char* data_ = nullptr;
+    size_t               size_ = 0;
+    size_t               pos_  = 0;
+
+    Format format_       = Format::PCAP;
+    bool   swapped_      = false; // file byte order differs from host
+    int    link_type_    = -1;    // pcap only
+
+    std::vector<int> interface_link_types_; // pcapng, per interface in current section
+
+    size_t advised_until_ = 0;
+    size_t released_until_ = 0;
+
+    size_t num_read_    = 0;
+    size_t num_dropped_ = 0;
+    size_t bytes_read_  = 0;
+};
@@ -0,0 +1,172 @@
+/*
+ * This file is part of OpenATS COMPASS.
+ *
+ * COMPASS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * COMPASS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with COMPASS. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+/**
+ * Lock-free byte ring buffer for a single producer and a single consumer thread.
+ *
+ * Written blocks (e.g. received datagrams) are never split at the end of the buffer. If a block
+ * does not fit into the remaining space, the producer marks the end of the valid data and continues
+ * at the beginning. The consumer can therefore access all readable data as at most two contiguous
+ * regions holding whole blocks, which can be processed in place before being released.
+ *
+ * Blocks which do not fit into the free space are dropped and counted.
+ */
+class SPSCRingBuffer
+{
+public:
+    explicit SPSCRingBuffer(size_t capacity)
+    :   capacity_(capacity)
+    ,   data_    (new char[capacity])
+    {
+        assert(capacity_ > 1);
+    }
+
+    size_t capacity() const { return capacity_; }
+
+    /**
+     * Producer: appends the block as a whole, returns false and counts the bytes as dropped if it does not fit.
+     */
+    bool write(const char* data, size_t length)
+    {
+        if (!length)
+            return true;
+
+        size_t w = write_pos_.load(std::memory_order_relaxed);
+        size_t r = read_pos_.load(std::memory_order_acquire);
+
+        size_t new_w;
+
+        if (w >= r) // not wrapped, free space at end and before read position
+        {
+            if (capacity_ - w >= length)
+            {
+                std::memcpy(data_.get() + w, data, length);
+                new_w = w + length;
+            }
+            else if (r > length) // wrap, write position must not catch up with read position
+            {
+                std::memcpy(data_.get(), data, length);
+                end_pos_.store(w, std::memory_order_relaxed); // published by write position
+                new_w = length;
+            }
+            else
+            {
+                return drop(length);
+            }
+        }
+        else // wrapped, free space up to read position
+        {
+            if (r - w > length)
+            {
+                std::memcpy(data_.get() + w, data, length);
+                new_w = w + length;
+            }
+            else
+            {
+                return drop(length);
+            }
+        }
+
+        write_pos_.store(new_w, std::memory_order_release);
+
+        bytes_written_.fetch_add(length, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    /**
+     * Consumer: returns the next contiguous readable region, empty if no data is available.
+     * The region stays valid until released.
+     */
+    std::pair<const char*, size_t> readRegion()
+    {
+        size_t r = read_pos_.load(std::memory_order_relaxed);
+        size_t w = write_pos_.load(std::memory_order_acquire);
+
+        if (w >= r)
+            return {data_.get() + r, w - r};
+
+        // wrapped
+        size_t end = end_pos_.load(std::memory_order_relaxed);
+
+        if (r == end) // all data at end consumed, continue at beginning
+        {
+            read_pos_.store(0, std::memory_order_release);
+            return {data_.get(), w};
+        }
+
+        assert(r < end);
+
+        return {data_.get() + r, end - r};
+    }
+
+    /**
+     * Consumer: releases length bytes of the region returned by readRegion().
+     */
+    void release(size_t length)
+    {
+        size_t r = read_pos_.load(std::memory_order_relaxed);
+        read_pos_.store(r + length, std::memory_order_release);
+    }
+
+    // approximate if called concurrently
+    size_t size() const
+    {
+        size_t r = read_pos_.load(std::memory_order_acquire);
+        size_t w = write_pos_.load(std::memory_order_acquire);
+
+        if (w >= r)
+            return w - r;
+
+        return end_pos_.load(std::memory_order_relaxed) - r + w;
+    }
+
+    bool empty() const { return size() == 0; }
+
+    size_t bytesWritten() const { return bytes_written_.load(std::memory_order_relaxed); }
+    size_t bytesDropped() const { return bytes_dropped_.load(std::memory_order_relaxed); }
+    size_t numDrops() const { return num_drops_.load(std::memory_order_relaxed); }
+
+private:
+    const size_t            capacity_;
+    std::unique_ptr<char[]> data_;
+
+    std::atomic<size_t> write_pos_ {0}; // written by producer only
+    std::atomic<size_t> read_pos_  {0}; // written by consumer only
+    std::atomic<size_t> end_pos_   {0}; // end of valid data if wrapped, written by producer only
+
+    std::atomic<size_t> bytes_written_ {0};
+    std::atomic<size_t> bytes_dropped_ {0};
+    std::atomic<size_t> num_drops_     {0};
+
+    bool drop(size_t length)
+    {
+        bytes_dropped_.fetch_add(length, std::memory_order_relaxed);
+        num_drops_.fetch_add(1, std::memory_order_relaxed);
+
+        return false;
+    }
+};
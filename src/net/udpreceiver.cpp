@@ -5,6 +5,14 @@
 
 #include <boost/bind.hpp>
 
+#ifdef __linux__
+#include <sys/socket.h>
+#include <netinet/in.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+
 //using namespace Utils;
 using namespace std;
 
@@ -138,6 +146,8 @@ void UDPReceiver::handle_receive_from(const boost::system::error_code& error,
         }
         else // accept all
             data_callback_(data_, bytes_recvd);
+
+        receiveBatches(); // read datagrams queued in the meantime
     }
 
     //sender_endpoint_.address() should be set to sender ip
@@ -148,3 +158,76 @@ void UDPReceiver::handle_receive_from(const boost::system::error_code& error,
                             boost::asio::placeholders::error,
                             boost::asio::placeholders::bytes_transferred));
 }
+
+/**
+ * Reads all datagrams already queued at the socket in batches, using one recvmmsg call per batch
+ * where available, instead of one asynchronous receive per datagram.
+ */
+void UDPReceiver::receiveBatches()
+{
+#ifdef __linux__
+    unsigned int num_slots = std::min(MaxBatchSize, max_read_size_ / BatchSlotSize);
+
+    if (num_slots < 2)
+        return;
+
+    mmsghdr msgs[MaxBatchSize];
+    iovec iovecs[MaxBatchSize];
+    sockaddr_storage sender_addrs[MaxBatchSize];
+
+    int fd = socket_.native_handle();
+
+    while (1)
+    {
+        memset(msgs, 0, sizeof(msgs));
+
+        for (unsigned int cnt=0; cnt < num_slots; ++cnt)
+        {
+            iovecs[cnt].iov_base = data_ + cnt * BatchSlotSize;
+            iovecs[cnt].iov_len  = BatchSlotSize;
+
+            msgs[cnt].msg_hdr.msg_iov     = &iovecs[cnt];
+            msgs[cnt].msg_hdr.msg_iovlen  = 1;
+            msgs[cnt].msg_hdr.msg_name    = &sender_addrs[cnt];
+            msgs[cnt].msg_hdr.msg_namelen = sizeof(sender_addrs[cnt]);
+        }
+
+        // does not block, errors are reported by the next asynchronous receive
+        int num_msgs = recvmmsg(fd, msgs, num_slots, MSG_DONTWAIT, nullptr);
+
+        if (num_msgs <= 0)
+            break;
+
+        for (int cnt=0; cnt < num_msgs; ++cnt)
+        {
+            if (has_sender_address_) // check
+            {
+                boost::asio::ip::address sender_addr;
+
+                if (sender_addrs[cnt].ss_family == AF_INET)
+                {
+                    const sockaddr_in* addr = reinterpret_cast<const sockaddr_in*>(&sender_addrs[cnt]);
+                    sender_addr = boost::asio::ip::address_v4(ntohl(addr->sin_addr.s_addr));
+                }
+                else if (sender_addrs[cnt].ss_family == AF_INET6)
+                {
+                    const sockaddr_in6* addr = reinterpret_cast<const sockaddr_in6*>(&sender_addrs[cnt]);
+
+                    boost::asio::ip::address_v6::bytes_type bytes;
+                    memcpy(bytes.data(), addr->sin6_addr.s6_addr, bytes.size());
+
+                    sender_addr = boost::asio::ip::address_v6(bytes);
+                }
+
+                if (sender_addr != sender_addr_)
+                    continue;
+            }
+
+            data_callback_(data_ + cnt * BatchSlotSize, msgs[cnt].msg_len);
+        }
+
+        if ((unsigned int) num_msgs < num_slots) // socket drained
+            break;
+    }
+#endif
+}
@@ -16,6 +16,10 @@ public:
                              size_t bytes_recvd);
 
 private:
+    static const unsigned int MaxBatchSize = 16;     // max datagrams read per batch
+    static const unsigned int BatchSlotSize = 65536; // max udp payload
+
+
     std::shared_ptr<DataSourceLineInfo> line_info_;
 
     boost::asio::ip::udp::endpoint socket_endpoint_;
@@ -29,6 +33,8 @@ private:
 
     unsigned int max_read_size_ {0};
     char* data_ {nullptr};
+
+    void receiveBatches();
 };
 
 #endif // UDPRECEIVER_H
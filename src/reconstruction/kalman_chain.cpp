@@ -24,6 +24,7 @@
 
 
 #include <cmath>
+#include <random>
 
 namespace reconstruction
 {
@@ -1404,4 +1405,138 @@ bool KalmanChain::checkMeasurementAvailability() const
     return true;
 }
 
+/**
+ * Reestimates a long synthetic chain with and without fixed-size kalman kernels and logs the rates.
+ * Every second measurement is added in one batch, then num_inserts of the remaining measurements are
+ * inserted near the chain start, each triggering a reestimation of the following updates.
+ * Only used by the benchmark runtime command, not by the reconstructor.
+*/
+KalmanChain::ReestimateBenchmark KalmanChain::benchmarkReestimate(kalman::KalmanType ktype,
+                                                                  const KalmanEstimator::Settings& settings,
+                                                                  size_t num_updates,
+                                                                  size_t num_inserts)
+{
+    loginf << "KalmanChain: benchmarkReestimate: updates " << num_updates << " inserts " << num_inserts;
+
+    //straight track with noisy positions
+    std::vector<Measurement> mms(num_updates);
+
+    std::mt19937 generator(0);
+    std::normal_distribution<double> noise(0.0, 30.0);
+
+    const double lat0 = 47.5, lon0 = 14.5;
+    const double m_per_deg = 111320.0;
+    const boost::posix_time::ptime t0 = boost::posix_time::time_from_string("2024-01-01 00:00:00.000");
+
+    for (size_t i = 0; i < num_updates; ++i)
+    {
+        Measurement& mm = mms[ i ];
+
+        double x = 200.0 * i + noise(generator);
+        double y = 20.0 * i + noise(generator);
+
+        mm.source_id = i;
+        mm.t         = t0 + boost::posix_time::milliseconds(1000 * i);
+        mm.lat       = lat0 + y / m_per_deg;
+        mm.lon       = lon0 + x / (m_per_deg * std::cos(lat0 * M_PI / 180.0));
+        mm.x_stddev  = 30.0;
+        mm.y_stddev  = 30.0;
+        mm.xy_cov    = 0.0;
+    }
+
+    num_inserts = std::min(num_inserts, num_updates / 2);
+
+    ReestimateBenchmark result;
+    result.num_inserted = num_inserts;
+
+    auto runChain = [ & ] (bool fixed_size_kernels,
+                           std::vector<kalman::KalmanUpdateMinimal>& updates,
+                           ReestimateBenchmark::Rates& rates)
+    {
+        KalmanEstimator::Settings estimator_settings = settings;
+        estimator_settings.fixed_size_kernels = fixed_size_kernels;
+
+        KalmanChain chain;
+        chain.settings().mode = Settings::Mode::DynamicInserts;
+        chain.configureEstimator(estimator_settings);
+        chain.init(ktype);
+        chain.setMeasurementGetFunc([ & ] (unsigned long mm_id) -> const Measurement& { return mms.at(mm_id); });
+
+        std::vector<std::pair<unsigned long, boost::posix_time::ptime>> added;
+        for (size_t i = 0; i < num_updates; i += 2)
+            added.emplace_back(i, mms[ i ].t);
+
+        auto t_start = boost::posix_time::microsec_clock::local_time();
+
+        bool ok = chain.add(added, true);
+
+        auto t_added = boost::posix_time::microsec_clock::local_time();
+
+        for (size_t i = 0; i < num_inserts; ++i)
+            ok = chain.insert(2 * i + 1, mms[ 2 * i + 1 ].t, true) && ok;
+
+        auto t_inserted = boost::posix_time::microsec_clock::local_time();
+
+        double add_s    = Utils::Time::partialSeconds(t_added - t_start);
+        double insert_s = Utils::Time::partialSeconds(t_inserted - t_added);
+
+        loginf << "KalmanChain: benchmarkReestimate: fixed size kernels " << fixed_size_kernels
+               << ": add " << added.size() << " in " << add_s << "s"
+               << " (" << (add_s > 0 ? added.size() / add_s : 0.0) << "/s)"
+               << ", " << num_inserts << " inserts in " << insert_s << "s"
+               << " (" << (insert_s > 0 ? num_inserts / insert_s : 0.0) << "/s)"
+               << " ok " << ok;
+
+        result.num_added   = added.size();
+        rates.add_per_s    = add_s > 0 ? added.size() / add_s : 0.0;
+        rates.insert_per_s = insert_s > 0 ? num_inserts / insert_s : 0.0;
+        rates.ok           = ok;
+
+        updates.resize(chain.size());
+        for (size_t i = 0; i < chain.size(); ++i)
+            updates[ i ] = chain.getKalmanUpdate(i);
+    };
+
+    std::vector<kalman::KalmanUpdateMinimal> updates_fixed, updates_dynamic;
+
+    runChain(true, updates_fixed, result.fixed_size_kernels);
+    runChain(false, updates_dynamic, result.dynamic_kernels);
+
+    if (updates_fixed.size() != updates_dynamic.size())
+    {
+        logerr << "KalmanChain: benchmarkReestimate: chain sizes differ";
+        return result;
+    }
+
+    double max_diff_x = 0.0;
+    double max_diff_P = 0.0;
+
+    for (size_t i = 0; i < updates_fixed.size(); ++i)
+    {
+        const auto& u0 = updates_fixed[ i ];
+        const auto& u1 = updates_dynamic[ i ];
+
+        if (u0.valid != u1.valid || u0.x.size() != u1.x.size() || u0.P.size() != u1.P.size())
+        {
+            logerr << "KalmanChain: benchmarkReestimate: updates differ at " << i;
+            return result;
+        }
+
+        if (!u0.valid)
+            continue;
+
+        max_diff_x = std::max(max_diff_x, (u0.x - u1.x).cwiseAbs().maxCoeff());
+        max_diff_P = std::max(max_diff_P, (u0.P - u1.P).cwiseAbs().maxCoeff());
+    }
+
+    result.max_state_diff = max_diff_x;
+    result.max_cov_diff   = max_diff_P;
+    result.same_results   = max_diff_x < 1e-3 && max_diff_P < 1e-3;
+
+    loginf << "KalmanChain: benchmarkReestimate: max state diff " << max_diff_x
+           << " max cov diff " << max_diff_P << " same " << result.same_results;
+
+    return result;
+}
+
 } // reconstruction
@@ -107,6 +107,24 @@ public:
         bool                        init = false;
     };
 
+    struct ReestimateBenchmark
+    {
+        struct Rates
+        {
+            double add_per_s    = 0.0;
+            double insert_per_s = 0.0;
+            bool   ok           = false;
+        };
+
+        size_t num_added    = 0;
+        size_t num_inserted = 0;
+        Rates  fixed_size_kernels;
+        Rates  dynamic_kernels;
+        double max_state_diff = 0.0;
+        double max_cov_diff   = 0.0;
+        bool   same_results   = false;
+    };
+
     typedef std::pair<int, int>                              Interval;
     typedef std::unique_ptr<KalmanOnlineTracker>             TrackerPtr;
     typedef std::unique_ptr<KalmanEstimator>                 EstimatorPtr;
@@ -187,6 +205,11 @@ public:
 
     Settings& settings();
 
+    static ReestimateBenchmark benchmarkReestimate(kalman::KalmanType ktype,
+                                                   const KalmanEstimator::Settings& settings,
+                                                   size_t num_updates = 10000,
+                                                   size_t num_inserts = 500);
+
 private:
     struct Tracker
     {
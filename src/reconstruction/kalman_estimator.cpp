@@ -143,6 +143,7 @@ void KalmanEstimator::init(std::unique_ptr<KalmanInterface>&& interface)
 
     //configure & init interface
     kalman_interface_->setVerbosity(settings_.verbosity);
+    kalman_interface_->enableFixedSizeKernels(settings_.fixed_size_kernels);
     
     //configure projection handler
     proj_handler_->settings().proj_dist_check        = settings_.proj_distance_check;
@@ -1208,7 +1209,9 @@ bool KalmanEstimator::interpUpdates(std::vector<kalman::KalmanUpdate>& interp_up
                                        phandler,
                                        num_steps_failed);
         
-        interp_updates.insert(interp_updates.end(), interp_updates_chain.begin(), interp_updates_chain.end());
+        interp_updates.insert(interp_updates.end(), 
+                              std::make_move_iterator(interp_updates_chain.begin()), 
+                              std::make_move_iterator(interp_updates_chain.end()));
     };
 
     executeChainFunc(updates, func);
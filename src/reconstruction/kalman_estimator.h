@@ -98,6 +98,8 @@ public:
         bool fix_predictions_interp = false;
 
         bool extract_wgs84_pos = false;
+
+        bool fixed_size_kernels = true; // use fixed-size matrix computations if supported by the kalman filter
         
         int  verbosity = 0;
         bool debug     = false;
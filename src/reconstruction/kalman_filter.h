@@ -49,6 +49,7 @@ public:
     size_t dimZ() const { return dim_z_; }
 
     virtual void enableDebugging(bool ok);
+    virtual void enableFixedSizeKernels(bool ok) {} // only if supported by filter
 
     Error predict(double dt,
                   double Q_var,
@@ -156,6 +156,12 @@ KalmanFilter::Error KalmanFilterLinear::predict(Vector& x,
                                                 const OMatrix& B,
                                                 const OVector& u) const
 {
+    if (use_fixed_size_kernels_ && fixed_size_kernels_.predict && !(B.has_value() && u.has_value()))
+    {
+        fixed_size_kernels_.predict(x, P, x_, P_, F, Q, alpha_sq_);
+        return Error::NoError;
+    }
+
     // x = Fx + Bu
     x = F * x_;
     if (B.has_value() && u.has_value())
@@ -188,6 +194,16 @@ KalmanFilter::Error KalmanFilterLinear::update(const Vector& z,
 {
     z_.reset();
 
+    if (use_fixed_size_kernels_ && fixed_size_kernels_.update)
+    {
+        if (!fixed_size_kernels_.update(x_, P_, y_, S_, SI_, K_, z, R, H))
+            return Error::Numeric;
+
+        z_ = z;
+
+        return Error::NoError;
+    }
+
     // y = z - Hx
     // error (residual) between measurement and prediction
     y_ = z - H * x_;
@@ -294,6 +310,39 @@ bool KalmanFilterLinear::smooth_impl(std::vector<kalman::Vector>& x_smooth,
     if (state_valid)
         state_valid->assign(n, true);
 
+    kalman::Vector x_smooth_1_tr;
+
+    if (use_fixed_size_kernels_ && fixed_size_kernels_.smoothing_step)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            x_smooth   [ i ] = states[ i ].x;
+            P_smooth   [ i ] = states[ i ].P;
+        }
+
+        for (int k = n - 2; k >= 0; --k)
+        {
+            //get last smoothed state vector
+            if (x_tr) x_tr(x_smooth_1_tr, x_smooth[ k+1 ], k + 1, k);
+            const kalman::Vector& x_smooth_1 = x_tr ? x_smooth_1_tr : x_smooth[ k+1 ];
+
+            if (!fixed_size_kernels_.smoothing_step(x_smooth[ k ], P_smooth[ k ], nullptr, nullptr,
+                                                    x_smooth_1, P_smooth[ k+1 ],
+                                                    states[ k+1 ].F, states[ k+1 ].Q, smooth_scale))
+                return false;
+
+            bool state_ok = (stop_on_fail || state_valid) ? checkState(x_smooth[ k ], P_smooth[ k ]) : true;
+
+            if (stop_on_fail && !state_ok)
+                return false;
+
+            if (state_valid)
+                (*state_valid)[ k ] = state_ok;
+        }
+
+        return true;
+    }
+
     std::vector<kalman::Matrix> Pp(n);
     std::vector<kalman::Matrix> K (n);
 
@@ -308,8 +357,6 @@ bool KalmanFilterLinear::smooth_impl(std::vector<kalman::Vector>& x_smooth,
     if (states.size() < 2)
         return true;
 
-    kalman::Vector x_smooth_1_tr;
-
     for (int k = n - 2; k >= 0; --k)
     {
         const auto& F_1  = states[ k+1 ].F;
@@ -356,6 +403,18 @@ bool KalmanFilterLinear::smoothingStep_impl(Vector& x0_smooth,
                                             double smooth_scale,
                                             RTSStepInfo* debug_info) const
 {
+    if (use_fixed_size_kernels_ && fixed_size_kernels_.smoothing_step)
+    {
+        if (!fixed_size_kernels_.smoothing_step(x0_smooth, P0_smooth, &x1_pred, &P1_pred,
+                                                x1_smooth_tr, P1_smooth, state1.F, state1.Q, smooth_scale))
+        {
+            loginf << "KalmanFilterLinear: smoothingStep_impl: Could not invert P1_pred:\n" << P1_pred;
+            return false;
+        }
+
+        return true;
+    }
+
     const auto& F_1  = state1.F;
     const auto& Q_1  = state1.Q;
     auto        F_1t = F_1.transpose();
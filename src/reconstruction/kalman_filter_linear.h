@@ -74,7 +74,31 @@ public:
     void setFMatFunc(const FMatFunc& func) { F_func_ = func; }
     void setQMatFunc(const QMatFunc& func) { Q_func_ = func; }
 
+    void enableFixedSizeKernels(bool ok) override final { use_fixed_size_kernels_ = ok; }
+    bool hasFixedSizeKernels() const { return fixed_size_kernels_.predict != nullptr; }
+
 protected:
+    /**
+     * Function pointers to fixed-size implementations, set by derived filters of known dimensions
+     * (see kalman_filter_linear_kernels.h). If not set, the dynamically sized computations are used.
+     */
+    struct FixedSizeKernels
+    {
+        typedef void (*PredictFunc)(Vector&, Matrix&, const Vector&, const Matrix&,
+                                    const Matrix&, const Matrix&, double);
+        typedef bool (*UpdateFunc)(Vector&, Matrix&, Vector&, Matrix&, Matrix&, Matrix&,
+                                   const Vector&, const Matrix&, const Matrix&);
+        typedef bool (*SmoothingStepFunc)(Vector&, Matrix&, Vector*, Matrix*,
+                                          const Vector&, const Matrix&, const Matrix&, const Matrix&, double);
+
+        PredictFunc       predict        = nullptr;
+        UpdateFunc        update         = nullptr;
+        SmoothingStepFunc smoothing_step = nullptr;
+    };
+
+    template <int DimX, int DimZ>
+    void setFixedSizeKernels();
+
     Error predict(Vector& x,
                   Matrix& P,
                   const Matrix& F,
@@ -139,6 +163,9 @@ private:
 
     double alpha_sq_ = 1.0; // fading memory control
 
+    FixedSizeKernels fixed_size_kernels_;
+    bool             use_fixed_size_kernels_ = true;
+
     using KalmanFilter::dim_x_;
     using KalmanFilter::dim_z_;
 
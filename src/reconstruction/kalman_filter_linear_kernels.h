@@ -0,0 +1,167 @@
+/*
+ * This file is part of OpenATS COMPASS.
+ *
+ * COMPASS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * COMPASS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with COMPASS. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "kalman_filter_linear.h"
+
+#include <Eigen/Dense>
+
+namespace kalman
+{
+
+/**
+ * Fixed-size versions of the linear kalman predict, update and RTS smoothing step.
+ *
+ * The dynamically sized inputs are copied to stack-allocated matrices of the given
+ * dimensions, so that no heap allocations occur during computation. Results are
+ * assigned back to the dynamically sized outputs, which only reallocate if their size changes.
+ */
+template <int DimX, int DimZ>
+struct KalmanFilterLinearKernels
+{
+    typedef Eigen::Matrix<double, DimX, DimX> MatrixX;
+    typedef Eigen::Matrix<double, DimZ, DimZ> MatrixZ;
+    typedef Eigen::Matrix<double, DimZ, DimX> MatrixZX;
+    typedef Eigen::Matrix<double, DimX, DimZ> MatrixXZ;
+    typedef Eigen::Matrix<double, DimX, 1>    VectorX;
+    typedef Eigen::Matrix<double, DimZ, 1>    VectorZ;
+
+    /**
+     * x = F*x0, P = alpha_sq*F*P0*F' + Q
+     */
+    static void predict(Vector& x,
+                        Matrix& P,
+                        const Vector& x0,
+                        const Matrix& P0,
+                        const Matrix& F,
+                        const Matrix& Q,
+                        double alpha_sq)
+    {
+        const MatrixX F_f(F);
+
+        const VectorX x_f = F_f * VectorX(x0);
+        const MatrixX P_f = alpha_sq * (F_f * MatrixX(P0) * F_f.transpose()) + MatrixX(Q);
+
+        x = x_f;
+        P = P_f;
+    }
+
+    /**
+     * Updates x and P using measurement z. Residual y and system uncertainty S are always set,
+     * returns false if S is not invertible, in which case x, P, SI and K are not changed.
+     */
+    static bool update(Vector& x,
+                       Matrix& P,
+                       Vector& y,
+                       Matrix& S,
+                       Matrix& SI,
+                       Matrix& K,
+                       const Vector& z,
+                       const Matrix& R,
+                       const Matrix& H)
+    {
+        const MatrixZX H_f(H);
+        const MatrixZ  R_f(R);
+
+        VectorX x_f(x);
+        MatrixX P_f(P);
+
+        const VectorZ  y_f = VectorZ(z) - H_f * x_f;
+        const MatrixXZ PHT = P_f * H_f.transpose();
+        const MatrixZ  S_f = H_f * PHT + R_f;
+
+        y = y_f;
+        S = S_f;
+
+        if (!Eigen::FullPivLU<MatrixZ>(S_f).isInvertible())
+            return false;
+
+        const MatrixZ  SI_f = S_f.inverse();
+        const MatrixXZ K_f  = PHT * SI_f;
+
+        x_f += K_f * y_f;
+
+        const MatrixX I_KH = MatrixX::Identity() - K_f * H_f;
+        P_f = I_KH * P_f * I_KH.transpose() + K_f * R_f * K_f.transpose();
+
+        x  = x_f;
+        P  = P_f;
+        SI = SI_f;
+        K  = K_f;
+
+        return true;
+    }
+
+    /**
+     * RTS smoothing step of state 0 using the smoothed state 1 and the transition F1, Q1 of state 1.
+     * The predicted state 1 is optionally returned, returns false if its covariance is not invertible.
+     */
+    static bool smoothingStep(Vector& x0_smooth,
+                              Matrix& P0_smooth,
+                              Vector* x1_pred,
+                              Matrix* P1_pred,
+                              const Vector& x1_smooth,
+                              const Matrix& P1_smooth,
+                              const Matrix& F1,
+                              const Matrix& Q1,
+                              double smooth_scale)
+    {
+        const MatrixX F_f  = F1;
+        const MatrixX F_ft = F_f.transpose();
+
+        VectorX x0_f(x0_smooth);
+        MatrixX P0_f(P0_smooth);
+
+        const VectorX x1_pred_f = F_f * x0_f;
+        const MatrixX P1_pred_f = F_f * P0_f * F_ft + MatrixX(Q1);
+
+        if (x1_pred)
+            *x1_pred = x1_pred_f;
+        if (P1_pred)
+            *P1_pred = P1_pred_f;
+
+        if (!Eigen::FullPivLU<MatrixX>(P1_pred_f).isInvertible())
+            return false;
+
+        const MatrixX K_f = (P0_f * F_ft * P1_pred_f.inverse()) * smooth_scale;
+
+        x0_f += K_f * (VectorX(x1_smooth) - x1_pred_f);
+        P0_f += K_f * (MatrixX(P1_smooth) - P1_pred_f) * K_f.transpose();
+
+        x0_smooth = x0_f;
+        P0_smooth = P0_f;
+
+        return true;
+    }
+};
+
+/**
+ * Selects the fixed-size kernels for the given dimensions, which have to match the filter's dimensions.
+ */
+template <int DimX, int DimZ>
+void KalmanFilterLinear::setFixedSizeKernels()
+{
+    assert(dim_x_ == DimX);
+    assert(dim_z_ == DimZ);
+
+    fixed_size_kernels_.predict        = &KalmanFilterLinearKernels<DimX, DimZ>::predict;
+    fixed_size_kernels_.update         = &KalmanFilterLinearKernels<DimX, DimZ>::update;
+    fixed_size_kernels_.smoothing_step = &KalmanFilterLinearKernels<DimX, DimZ>::smoothingStep;
+}
+
+} // namespace kalman
@@ -17,6 +17,7 @@
  */
 
 #include "kalman_filter_um2d.h"
+#include "kalman_filter_linear_kernels.h"
 #include "logger.h"
 
 #include <Eigen/Dense>
@@ -50,6 +51,12 @@ KalmanFilterUM2D::KalmanFilterUM2D(bool track_velocities)
     setQMatFunc(Q_func);
     
     setInvertStateFunc(inv_func);
+
+    //dimensions known at compile time
+    if (track_velocities)
+        setFixedSizeKernels<4, 4>();
+    else
+        setFixedSizeKernels<4, 2>();
 }
 
 /**
@@ -491,4 +491,12 @@ void KalmanInterface::enableDebugging(bool ok)
     kalman_filter_->enableDebugging(ok);
 }
 
+/**
+*/
+void KalmanInterface::enableFixedSizeKernels(bool ok)
+{
+    assert(kalman_filter_);
+    kalman_filter_->enableFixedSizeKernels(ok);
+}
+
 } // reconstruction
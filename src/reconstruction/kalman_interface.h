@@ -146,6 +146,7 @@ public:
 
     void setVerbosity(int v) { verbosity_ = v; }
     void enableDebugging(bool ok);
+    void enableFixedSizeKernels(bool ok);
 
 protected:
     int verbosity() const { return verbosity_; }
@@ -504,6 +504,10 @@ std::vector<MeasurementInterp> SplineInterpolator::interpolate(const std::vector
     //split up measurements time-based
     auto measurements_parts = SplineInterpolator::splitMeasurements(measurements, config().max_dt);
 
+    //single part => no need to join
+    if (measurements_parts.size() == 1)
+        return interpolatePart(measurements_parts[ 0 ]);
+
     std::vector<MeasurementInterp> interpolation;
 
     //interpolate individual parts
@@ -512,7 +516,9 @@ std::vector<MeasurementInterp> SplineInterpolator::interpolate(const std::vector
         auto res = interpolatePart(p);
 
         if (res.size() > 0)
-            interpolation.insert(interpolation.end(), res.begin(), res.end());
+            interpolation.insert(interpolation.end(), 
+                                 std::make_move_iterator(res.begin()), 
+                                 std::make_move_iterator(res.end()));
     }
     
     return interpolation;
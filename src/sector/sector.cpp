@@ -20,12 +20,13 @@
 #include "evaluationmanager.h"
 #include "dbcontent/target/targetposition.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <limits>
 
 #include <ogr_geometry.h>
 
-#include <QPainter>
-
 using namespace nlohmann;
 using namespace std;
 
@@ -49,10 +50,10 @@ SectorInsideTest::SectorInsideTest(const std::vector<std::pair<double,double>>&
 
 SectorInsideTest::~SectorInsideTest() = default;
 
-void SectorInsideTest::map2Image(double& xm, double& ym, double x, double y) const
+void SectorInsideTest::map2Grid(double& xm, double& ym, double x, double y) const
 {
-    xm = ImgBorder + BorderRegion + (x - xmin_) * tx_;
-    ym = ImgBorder + BorderRegion + (y - ymin_) * ty_;
+    xm = GridBorder + (x - xmin_) * tx_;
+    ym = GridBorder + (y - ymin_) * ty_;
 }
 
 void SectorInsideTest::create(const std::vector<std::pair<double,double>>& points, 
@@ -61,7 +62,17 @@ void SectorInsideTest::create(const std::vector<std::pair<double,double>>& point
                               double xmax, 
                               double ymax)
 {
-    img_ = QImage();
+    cells_x_ = 0;
+    cells_y_ = 0;
+
+    inside_bits_      = {};
+    border_bits_      = {};
+    edge_x0_          = {};
+    edge_y0_          = {};
+    edge_x1_          = {};
+    edge_y1_          = {};
+    row_edge_offsets_ = {};
+    row_edges_        = {};
 
     //check if bounds are even valid
     if (!std::isfinite(xmin) ||
@@ -69,7 +80,8 @@ void SectorInsideTest::create(const std::vector<std::pair<double,double>>& point
         !std::isfinite(xmax) ||
         !std::isfinite(ymax) ||
         xmax <= xmin || 
-        ymax <= ymin)
+        ymax <= ymin ||
+        points.size() < 3)
         return;
 
     //remember origin for later mapping
@@ -89,140 +101,262 @@ void SectorInsideTest::create(const std::vector<std::pair<double,double>>& point
         aspect > 1e+06)
         return;
 
-    //generate image area of data aspect with maximum extent of 'ImageSize'
-    int area_w = (int)std::max(1.0, aspect >= 1 ? ImageSize : std::ceil(ImageSize * aspect));
-    int area_h = (int)std::max(1.0, aspect >= 1 ? std::ceil(ImageSize / aspect) : ImageSize);
+    //generate grid area of data aspect with maximum extent of 'GridSize'
+    int area_w = (int)std::max(1.0, aspect >= 1 ? GridSize : std::ceil(GridSize * aspect));
+    int area_h = (int)std::max(1.0, aspect >= 1 ? std::ceil(GridSize / aspect) : GridSize);
 
-    //data -> image mapping factors
+    //data -> grid mapping factors
     tx_ = area_w / dx;
     ty_ = area_h / dy;
 
-    //we add some border for final image size
-    int imgw = area_w + 2 * ImgBorder + 2 * BorderRegion;
-    int imgh = area_h + 2 * ImgBorder + 2 * BorderRegion;
-
-    img_ = QImage(imgw , imgh, QImage::Format_Grayscale8);
-    img_.fill(Qt::black); //initially fill with black color (= all outside)
+    //we add some border for final grid size
+    size_t cells_x = area_w + 2 * GridBorder;
+    size_t cells_y = area_h + 2 * GridBorder;
+    size_t words   = (cells_x * cells_y + WordBits - 1) / WordBits;
 
+    //collect edges of the (implicitly closed) polygon, skipping degenerate ones
     size_t n = points.size();
 
-    //convert points to image space
-    QPolygonF poly(n);
-    double xm, ym;
-
     for (size_t i = 0; i < n; ++i)
     {
-        map2Image(xm, ym, points[ i ].first, points[ i ].second);
-        poly[ i ] = QPointF(xm, ym);
+        const auto& p0 = points[ i ];
+        const auto& p1 = points[ (i + 1) % n ];
+
+        if (p0 == p1)
+            continue;
+
+        edge_x0_.push_back(p0.first);
+        edge_y0_.push_back(p0.second);
+        edge_x1_.push_back(p1.first);
+        edge_y1_.push_back(p1.second);
     }
 
-    //!disable antialiasing!
-    QPainter p(&img_);
-    p.setRenderHint(QPainter::RenderHint::Antialiasing, false);
-    p.setRenderHint(QPainter::RenderHint::HighQualityAntialiasing, false);
+    size_t num_edges = edge_x0_.size();
+    if (num_edges < 3)
+        return;
 
-    QPen pen;
-    QBrush brush;
+    cells_x_ = cells_x;
+    cells_y_ = cells_y;
 
-    pen.setCapStyle(Qt::PenCapStyle::RoundCap);
-    pen.setJoinStyle(Qt::PenJoinStyle::RoundJoin);
+    inside_bits_.assign(words, 0);
+    border_bits_.assign(words, 0);
 
-    //draw inside region (= region where we assume inside for sure)
+    //convert edges to grid space
+    std::vector<std::pair<double,double>> grid_points(2 * num_edges);
+
+    for (size_t e = 0; e < num_edges; ++e)
+    {
+        map2Grid(grid_points[ 2 * e     ].first, grid_points[ 2 * e     ].second, edge_x0_[ e ], edge_y0_[ e ]);
+        map2Grid(grid_points[ 2 * e + 1 ].first, grid_points[ 2 * e + 1 ].second, edge_x1_[ e ], edge_y1_[ e ]);
+    }
+
+    //bucket edges by the grid rows they overlap (counting pass, then filling pass)
+    auto rowRange = [ & ] (size_t e, size_t& r0, size_t& r1)
     {
-        pen.setColor(Qt::white);
-        pen.setWidth(1);
+        double gy0 = std::min(grid_points[ 2 * e ].second, grid_points[ 2 * e + 1 ].second);
+        double gy1 = std::max(grid_points[ 2 * e ].second, grid_points[ 2 * e + 1 ].second);
 
-        brush.setColor(Qt::white);
-        brush.setStyle(Qt::BrushStyle::SolidPattern);
+        r0 = (size_t)std::max(0.0, std::floor(gy0));
+        r1 = (size_t)std::min((double)cells_y_ - 1, std::floor(gy1));
+    };
 
-        p.setPen(pen);
-        p.setBrush(brush);
-        p.drawPolygon(poly);
+    row_edge_offsets_.assign(cells_y_ + 1, 0);
+
+    size_t r0, r1;
+    for (size_t e = 0; e < num_edges; ++e)
+    {
+        rowRange(e, r0, r1);
+        for (size_t r = r0; r <= r1; ++r)
+            ++row_edge_offsets_[ r + 1 ];
     }
-    
-    //draw border region (= region where we need an accurate - geometrical - inside check)
+
+    for (size_t r = 0; r < cells_y_; ++r)
+        row_edge_offsets_[ r + 1 ] += row_edge_offsets_[ r ];
+
+    row_edges_.resize(row_edge_offsets_.back());
+
+    std::vector<size_t> row_fill(row_edge_offsets_.begin(), row_edge_offsets_.end() - 1);
+
+    for (size_t e = 0; e < num_edges; ++e)
     {
-        pen.setColor(Qt::gray);
-        pen.setWidth(BorderRegion); //thicker pen for border region
-    
-        p.setPen(pen);
-        p.setBrush(Qt::NoBrush);
-        p.drawPolygon(poly);
-
-#if 0
-        //[DEBUG]
-        pen.setColor(Qt::black);
-        pen.setWidth(1);
-
-        p.setPen(pen);
-        p.drawPolygon(poly);
-#endif
+        rowRange(e, r0, r1);
+        for (size_t r = r0; r <= r1; ++r)
+            row_edges_[ row_fill[ r ]++ ] = (uint32_t)e;
+    }
+
+    //mark border region (= cells where we need an accurate inside check)
+    for (size_t e = 0; e < num_edges; ++e)
+        markBorderCells(grid_points[ 2 * e     ].first, grid_points[ 2 * e     ].second,
+                        grid_points[ 2 * e + 1 ].first, grid_points[ 2 * e + 1 ].second);
+
+    //fill inside region (= cells where we assume inside for sure)
+    fillInsideCells(grid_points);
+}
+
+/**
+ * Marks all cells touched by the given edge (in grid coordinates) as border cells,
+ * adding a safety margin of one cell in each direction.
+ */
+void SectorInsideTest::markBorderCells(double gx0, double gy0, double gx1, double gy1)
+{
+    if (gy0 > gy1)
+    {
+        std::swap(gx0, gx1);
+        std::swap(gy0, gy1);
+    }
+
+    long max_cx = (long)cells_x_ - 1;
+    long max_cy = (long)cells_y_ - 1;
+
+    long row0 = (long)std::floor(gy0);
+    long row1 = (long)std::floor(gy1);
+
+    for (long r = row0; r <= row1; ++r)
+    {
+        //x range of the edge inside the row
+        double xa = gx0;
+        double xb = gx1;
+
+        if (gy1 > gy0)
+        {
+            double ya = std::max((double)r    , gy0);
+            double yb = std::min((double)r + 1, gy1);
+
+            xa = gx0 + (gx1 - gx0) * (ya - gy0) / (gy1 - gy0);
+            xb = gx0 + (gx1 - gx0) * (yb - gy0) / (gy1 - gy0);
+        }
+
+        long cx0 = std::max(0L    , (long)std::floor(std::min(xa, xb)) - 1);
+        long cx1 = std::min(max_cx, (long)std::floor(std::max(xa, xb)) + 1);
+
+        for (long cy = std::max(0L, r - 1); cy <= std::min(max_cy, r + 1); ++cy)
+            for (long cx = cx0; cx <= cx1; ++cx)
+                setBit(border_bits_, cy * cells_x_ + cx);
+    }
+}
+
+/**
+ * Marks the cells whose centers lie inside the polygon via a scanline through the cell centers of each row.
+ * Cells not touched by the border are either completely inside or outside, so their center decides.
+ */
+void SectorInsideTest::fillInsideCells(const std::vector<std::pair<double,double>>& grid_points)
+{
+    std::vector<double> crossings;
+
+    for (size_t r = 0; r < cells_y_; ++r)
+    {
+        double yc = r + 0.5;
+
+        crossings.clear();
+
+        for (size_t i = row_edge_offsets_[ r ]; i < row_edge_offsets_[ r + 1 ]; ++i)
+        {
+            const auto& p0 = grid_points[ 2 * row_edges_[ i ]     ];
+            const auto& p1 = grid_points[ 2 * row_edges_[ i ] + 1 ];
+
+            if ((p0.second > yc) != (p1.second > yc))
+                crossings.push_back(p0.first + (p1.first - p0.first) * (yc - p0.second) / (p1.second - p0.second));
+        }
+
+        std::sort(crossings.begin(), crossings.end());
+
+        for (size_t i = 0; i + 1 < crossings.size(); i += 2)
+        {
+            //cells with center in [xa, xb)
+            long cx0 = std::max(0L            , (long)std::ceil(crossings[ i     ] - 0.5));
+            long cx1 = std::min((long)cells_x_, (long)std::ceil(crossings[ i + 1 ] - 0.5));
+
+            for (long cx = cx0; cx < cx1; ++cx)
+                setBit(inside_bits_, r * cells_x_ + cx);
+        }
     }
 }
 
-namespace
+/**
+ * Exact crossing number test using the polygon edges overlapping the given grid row.
+ */
+bool SectorInsideTest::crossingTest(double x, double y, size_t row) const
 {
-    SectorInsideTest::CheckResult whereAmI(const QImage& img, int x, int y)
+    bool inside = false;
+
+    for (size_t i = row_edge_offsets_[ row ]; i < row_edge_offsets_[ row + 1 ]; ++i)
     {
-        //when no accurate statement is possible we assume border region (= detailed check) 
-        if (img.isNull() || x < 0 || y < 0 || x >= img.width() || y >= img.height())
-            return SectorInsideTest::CheckResult::Border;
-
-        //check color code at pixel
-        auto rgb = img.pixel(x, y);
-
-        if (rgb == Qt::gray)
-            return SectorInsideTest::CheckResult::Border;
-        else if (rgb == Qt::white)
-            return SectorInsideTest::CheckResult::Inside;
-        else if (rgb == Qt::black)
-            return SectorInsideTest::CheckResult::Outside;
-
-        //again: when in doubt assume border region
-        return SectorInsideTest::CheckResult::Border;
+        auto e = row_edges_[ i ];
+
+        double x0 = edge_x0_[ e ];
+        double y0 = edge_y0_[ e ];
+        double x1 = edge_x1_[ e ];
+        double y1 = edge_y1_[ e ];
+
+        if ((y0 > y) != (y1 > y) && x < x0 + (x1 - x0) * (y - y0) / (y1 - y0))
+            inside = !inside;
     }
+
+    return inside;
 }
 
-SectorInsideTest::CheckResult SectorInsideTest::isInside(double x, double y) const
+bool SectorInsideTest::isInside(double x, double y) const
 {
-    if (!isValid())
-        return CheckResult::Border;
+    assert(isValid());
 
-    //map to image area
+    //map to grid area
     double xm, ym;
-    map2Image(xm, ym, x, y);
+    map2Grid(xm, ym, x, y);
 
-    //round down to pixel
-    int x0 = (int)xm;
-    int y0 = (int)ym;
+    //outside of grid => outside of polygon
+    if (!(xm >= 0 && ym >= 0 && xm < cells_x_ && ym < cells_y_))
+        return false;
 
-    //check 4-nh for map code
-    auto check00 = whereAmI(img_, x0    , y0    );
-    auto check10 = whereAmI(img_, x0 + 1, y0    );
-    auto check01 = whereAmI(img_, x0    , y0 + 1);
-    auto check11 = whereAmI(img_, x0 + 1, y0 + 1);
+    //round down to cell
+    size_t cx = (size_t)xm;
+    size_t cy = (size_t)ym;
 
-    //all outside? => assume outside
-    if (check00 == CheckResult::Outside &&
-        check10 == CheckResult::Outside &&
-        check01 == CheckResult::Outside &&
-        check11 == CheckResult::Outside)
-        return CheckResult::Outside;
+    size_t cell = cy * cells_x_ + cx;
 
-    //all inside? => assume inside
-    if (check00 == CheckResult::Inside &&
-        check10 == CheckResult::Inside &&
-        check01 == CheckResult::Inside &&
-        check11 == CheckResult::Inside)
-        return CheckResult::Inside;
+    //border cell => check accurately
+    if (testBit(border_bits_, cell))
+        return crossingTest(x, y, cy);
 
-    //rest => assume on border
-    return CheckResult::Border;
+    return testBit(inside_bits_, cell);
 }
 
 bool SectorInsideTest::isValid() const
 {
-    return !img_.isNull();
+    return cells_x_ > 0;
+}
+
+/***********************************************************************************
+ * SectorInsidePositions
+ ***********************************************************************************/
+
+void SectorInsidePositions::clear()
+{
+    latitudes_.clear();
+    longitudes_.clear();
+    altitudes_.clear();
+    has_altitude_.clear();
+    has_ground_bit_.clear();
+    ground_bit_set_.clear();
+}
+
+void SectorInsidePositions::reserve(size_t n)
+{
+    latitudes_.reserve(n);
+    longitudes_.reserve(n);
+    altitudes_.reserve(n);
+    has_altitude_.reserve(n);
+    has_ground_bit_.reserve(n);
+    ground_bit_set_.reserve(n);
+}
+
+void SectorInsidePositions::add(const dbContent::TargetPosition& pos, bool has_ground_bit, bool ground_bit_set)
+{
+    latitudes_.push_back(pos.latitude_);
+    longitudes_.push_back(pos.longitude_);
+    altitudes_.push_back(pos.has_altitude_ ? pos.altitude_ : 0.0);
+    has_altitude_.push_back(pos.has_altitude_);
+    has_ground_bit_.push_back(has_ground_bit);
+    ground_bit_set_.push_back(ground_bit_set);
 }
 
 /***********************************************************************************
@@ -548,31 +682,89 @@ bool Sector::isInside(const dbContent::TargetPosition& pos,
             return false;
         }
 
-        //check fast inside test if available
-        bool check_geom = true;
-        if (inside_test_.has_value())
-        {
-            auto res = inside_test_->isInside(pos.latitude_, pos.longitude_);
-            if (res == SectorInsideTest::CheckResult::Outside)
-                return false;
-            else if (res == SectorInsideTest::CheckResult::Inside)
-                check_geom = false; //geometrical check not needed
-            else 
-                check_geom = true;  //check yielded 'SectorInsideTest::CheckResult::Border' => check polygon geometrically
-        }
-
-        //check poly
-        if (check_geom)
-        {
-            OGRPoint ogr_pos (pos.latitude_, pos.longitude_);
-            if (!ogr_polygon_->Contains(&ogr_pos))
-                return false;
-        }
+        //check polygon
+        if (!isInsideXY(pos.latitude_, pos.longitude_))
+            return false;
     }
 
     return true;
 }
 
+/**
+ * Planar inside check of a position inside the bounding rect, uses the fast inside test if available.
+ */
+bool Sector::isInsideXY(double latitude, double longitude) const
+{
+    if (inside_test_.has_value())
+        return inside_test_->isInside(latitude, longitude);
+
+    OGRPoint ogr_pos (latitude, longitude);
+    return ogr_polygon_->Contains(&ogr_pos);
+}
+
+/**
+ * Batch version of isInside(), marks all positions inside the sector by setting their flag in marked.
+ * Positions already marked are skipped, so that the results of several sectors can be accumulated.
+ *
+ * Altitude and bounding rect checks are evaluated branchless over the position arrays, the planar check
+ * is only run for the remaining candidates.
+ */
+void Sector::markInside(std::vector<unsigned char>& marked,
+                        const SectorInsidePositions& positions,
+                        InsideCheckType check_type) const
+{
+    size_t n = positions.size();
+    assert(marked.size() == n);
+
+    if (!n)
+        return;
+
+    const double inf = std::numeric_limits<double>::infinity();
+
+    bool check_z  = check_type == InsideCheckType::XYZ || check_type == InsideCheckType::Z || check_type == InsideCheckType::ZMinOnly;
+    bool check_xy = check_type == InsideCheckType::XYZ || check_type == InsideCheckType::XY;
+
+    //unset limits are replaced by values which always pass
+    double alt_min = check_z && min_altitude_.has_value() ? min_altitude_.value() : -inf;
+    double alt_max = check_z && check_type != InsideCheckType::ZMinOnly && max_altitude_.has_value() ? max_altitude_.value() : inf;
+    double lat_min = check_xy && lat_min_.has_value() ? lat_min_.value() : -inf;
+    double lat_max = check_xy && lat_max_.has_value() ? lat_max_.value() : inf;
+    double lon_min = check_xy && lon_min_.has_value() ? lon_min_.value() : -inf;
+    double lon_max = check_xy && lon_max_.has_value() ? lon_max_.value() : inf;
+
+    unsigned char gb_excludes = check_z && min_altitude_.has_value() ? 1 : 0;
+
+    const double*        lat     = positions.latitudes_.data();
+    const double*        lon     = positions.longitudes_.data();
+    const double*        alt     = positions.altitudes_.data();
+    const unsigned char* has_alt = positions.has_altitude_.data();
+    const unsigned char* has_gb  = positions.has_ground_bit_.data();
+    const unsigned char* gb_set  = positions.ground_bit_set_.data();
+    const unsigned char* done    = marked.data();
+
+    std::vector<unsigned char> candidates(n);
+    unsigned char* cand = candidates.data();
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        unsigned char alt_ok  = (unsigned char)(!has_alt[ i ] | (!(alt[ i ] < alt_min) & !(alt[ i ] > alt_max)));
+        unsigned char gb_ok   = (unsigned char)!(has_gb[ i ] & gb_set[ i ] & gb_excludes);
+        unsigned char rect_ok = (unsigned char)((lat[ i ] >= lat_min) & (lat[ i ] <= lat_max) &
+                                                (lon[ i ] >= lon_min) & (lon[ i ] <= lon_max));
+
+        cand[ i ] = (unsigned char)(!done[ i ] & alt_ok & gb_ok & rect_ok);
+    }
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (!cand[ i ])
+            continue;
+
+        if (!check_xy || isInsideXY(lat[ i ], lon[ i ]))
+            marked[ i ] = 1;
+    }
+}
+
 std::pair<double, double> Sector::getMinMaxLatitude() const
 {
     assert(lat_min_.has_value() && lat_max_.has_value());
@@ -624,12 +816,6 @@ void Sector::createFastInsideTest() const
     //create sector inside test
     inside_test_ = SectorInsideTest(points_, lat_min_.value(), lon_min_.value(), lat_max_.value(), lon_max_.value());
 
-#if 0
-    //[DEBUG]
-    if (inside_test_->isValid())
-        inside_test_->image().save("/home/mcphatty/sector" + QString::number(id_) + "_inside_test.png");
-#endif
-
     //dump if invalid (numerical issues etc.)
     if (!inside_test_->isValid())
         inside_test_.reset();
@@ -21,9 +21,10 @@
 
 #include <QColor>
 #include <QRectF>
-#include <QImage>
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 #include <boost/optional.hpp>
 
@@ -36,23 +37,16 @@ class TargetPosition;
 class OGRPolygon;
 
 /**
- * Fast sector inside test via image discretization.
+ * Fast sector inside test via grid discretization.
  * 
- * Generates an discrete image map representation of the input polygon and checks this 
- * representation for definitely inside, definitely outside and dubious points.
- * Dubious points reside near the polygon border and can be checked later on with a
- * more accurate geometrical inside test. 
+ * Generates a discrete grid representation of the input polygon, storing for each cell whether it is
+ * definitely inside, definitely outside or touched by the polygon border as packed bits. Points in border
+ * cells are checked exactly via a crossing number test, using only the polygon edges overlapping the
+ * point's grid row.
  */
 class SectorInsideTest
 {
 public:
-    enum class CheckResult
-    {
-        Inside = 0,
-        Outside,
-        Border
-    };
-
     SectorInsideTest();
     SectorInsideTest(const std::vector<std::pair<double,double>>& points, 
                      double xmin, 
@@ -61,18 +55,21 @@ public:
                      double ymax);
     virtual ~SectorInsideTest();
 
-    CheckResult isInside(double x, double y) const;
+    bool isInside(double x, double y) const;
 
     bool isValid() const;
 
-    const QImage& image() const { return img_; }
+    size_t numCellsX() const { return cells_x_; }
+    size_t numCellsY() const { return cells_y_; }
 
 private:
-    static const int ImageSize    = 1000; //maximum image map extent (data region aspect will be preserved)
-    static const int ImgBorder    = 5;    //border added to the image map for safety
-    static const int BorderRegion = 7;    //width of the polygon border region (= dubious region)
+    typedef uint64_t Word;
 
-    void map2Image(double& xm, double& ym, double x, double y) const;
+    static const int    GridSize   = 1024; //maximum grid extent (data region aspect will be preserved)
+    static const int    GridBorder = 2;    //border cells added to the grid for safety
+    static const size_t WordBits   = 64;
+
+    void map2Grid(double& xm, double& ym, double x, double y) const;
 
     void create(const std::vector<std::pair<double,double>>& points, 
                 double xmin, 
@@ -80,13 +77,53 @@ private:
                 double xmax, 
                 double ymax);
 
-    QImage img_;
+    void markBorderCells(double gx0, double gy0, double gx1, double gy1);
+    void fillInsideCells(const std::vector<std::pair<double,double>>& grid_points);
+
+    void setBit(std::vector<Word>& bits, size_t cell) { bits[ cell / WordBits ] |= Word(1) << (cell % WordBits); }
+    static bool testBit(const std::vector<Word>& bits, size_t cell) { return (bits[ cell / WordBits ] >> (cell % WordBits)) & 1; }
+
+    bool crossingTest(double x, double y, size_t row) const;
+
+    size_t cells_x_ = 0;
+    size_t cells_y_ = 0;
+
+    std::vector<Word> inside_bits_; //cells definitely inside
+    std::vector<Word> border_bits_; //cells touched by the polygon border
+
+    std::vector<double> edge_x0_; //polygon edges in data coordinates
+    std::vector<double> edge_y0_;
+    std::vector<double> edge_x1_;
+    std::vector<double> edge_y1_;
+
+    std::vector<size_t>   row_edge_offsets_; //edges overlapping each grid row, indexes into row_edges_
+    std::vector<uint32_t> row_edges_;
+
     double xmin_ = 0;
     double ymin_ = 0;
     double tx_   = 1;
     double ty_   = 1;
 };
 
+/**
+ * Positions to be checked against sectors in batch, stored as separate arrays.
+ */
+struct SectorInsidePositions
+{
+    void clear();
+    void reserve(size_t n);
+    void add(const dbContent::TargetPosition& pos, bool has_ground_bit, bool ground_bit_set);
+
+    size_t size() const { return latitudes_.size(); }
+
+    std::vector<double>        latitudes_;
+    std::vector<double>        longitudes_;
+    std::vector<double>        altitudes_;
+    std::vector<unsigned char> has_altitude_;
+    std::vector<unsigned char> has_ground_bit_;
+    std::vector<unsigned char> ground_bit_set_;
+};
+
 /**
  * A basic sector.
  * - contains an id, a name and a name of the layer it belongs to
@@ -163,6 +200,9 @@ public:
                           bool has_ground_bit, 
                           bool ground_bit_set,
                           InsideCheckType check_type = InsideCheckType::XYZ) const;
+    void markInside(std::vector<unsigned char>& marked,
+                    const SectorInsidePositions& positions,
+                    InsideCheckType check_type = InsideCheckType::XYZ) const;
 
     std::pair<double, double> getMinMaxLatitude() const;
     std::pair<double, double> getMinMaxLongitude() const;
@@ -172,6 +212,8 @@ public:
 protected:
     void createPolygon();
 
+    bool isInsideXY(double latitude, double longitude) const;
+
     virtual bool readJSON_impl(const nlohmann::json& json_obj) { return true; };
     virtual void writeJSON_impl(nlohmann::json& json_obj) const {};
 
@@ -19,8 +19,10 @@
 #include "sector.h"
 #include "dbcontent/target/targetposition.h"
 #include "logger.h"
+#include "json.hpp"
 
 #include <cassert>
+#include <functional>
 
 using namespace std;
 
@@ -89,6 +91,32 @@ void SectorLayer::removeSector (std::shared_ptr<Sector> sector)
     }
 }
 
+/**
+ * Hash of everything the inside checks of the layer depend on (sector points, altitude limits, exclusion flags).
+ */
+size_t SectorLayer::definitionHash() const
+{
+    nlohmann::json j = nlohmann::json::array();
+
+    for (auto& sec_it : sectors_)
+    {
+        nlohmann::json j_sec;
+
+        j_sec["name"   ] = sec_it->name();
+        j_sec["exclude"] = sec_it->isExclusionSector();
+        j_sec["points" ] = sec_it->points();
+
+        if (sec_it->hasMinimumAltitude())
+            j_sec["min_altitude"] = sec_it->minimumAltitude();
+        if (sec_it->hasMaximumAltitude())
+            j_sec["max_altitude"] = sec_it->maximumAltitude();
+
+        j.push_back(j_sec);
+    }
+
+    return std::hash<std::string>()(name_ + j.dump());
+}
+
 void SectorLayer::clearSectors()
 {
     sectors_               = {};
@@ -143,6 +171,42 @@ bool SectorLayer::isInside(const dbContent::TargetPosition& pos,
     return !is_inside_exclude; // true if in no exclude, false if in include
 }
 
+/**
+ * Batch version of isInside(), sets the inside flag for each of the given positions.
+ */
+void SectorLayer::isInside(std::vector<unsigned char>& inside,
+                           const SectorInsidePositions& positions) const
+{
+    size_t n = positions.size();
+
+    inside.assign(n, 0);
+
+    // check if inside normal ones, positions found inside are skipped by the following sectors
+    for (auto& sec_it : sectors_)
+    {
+        if (!sec_it->isExclusionSector())
+            sec_it->markInside(inside, positions);
+    }
+
+    if (!hasExclusionSector()) // nothin more to check
+        return;
+
+    // check if inside exclude ones, only for positions inside a normal sector
+    std::vector<unsigned char> excluded(n);
+
+    for (size_t i = 0; i < n; ++i)
+        excluded[ i ] = !inside[ i ];
+
+    for (auto& sec_it : sectors_)
+    {
+        if (sec_it->isExclusionSector())
+            sec_it->markInside(excluded, positions);
+    }
+
+    for (size_t i = 0; i < n; ++i)
+        inside[ i ] &= !excluded[ i ];
+}
+
 std::pair<double, double> SectorLayer::getMinMaxLatitude() const
 {
     double min{0}, max{0};
@@ -23,6 +23,7 @@
 #include <memory>
 
 class Sector;
+struct SectorInsidePositions;
 
 namespace dbContent {
 class TargetPosition;
@@ -56,9 +57,13 @@ public:
     virtual bool isInside(const dbContent::TargetPosition& pos,
                           bool has_ground_bit, 
                           bool ground_bit_set) const;
+    virtual void isInside(std::vector<unsigned char>& inside,
+                          const SectorInsidePositions& positions) const;
 
     bool hasExclusionSector() const;
 
+    size_t definitionHash() const;
+
 protected:
     void checkExclusion();
 
@@ -0,0 +1,256 @@
+/*
+ * This file is part of OpenATS COMPASS.
+ *
+ * COMPASS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * COMPASS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with COMPASS. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark_commands.h"
+#include "rtcommand/rtcommand_macros.h"
+#include "rtcommand_registry.h"
+#include "compass.h"
+#include "taskmanager.h"
+#include "asteriximporttask.h"
+#include "asterixjsonparsingschema.h"
+#include "asterixjsonparser.h"
+#include "asterixjsonmappingjob.h"
+#include "reconstructortask.h"
+#include "reconstructorbase.h"
+#include "kalman_chain.h"
+#include "dbinterface.h"
+#include "util/files.h"
+#include "logger.h"
+#include "json.hpp"
+
+#include <fstream>
+
+#include <boost/program_options.hpp>
+
+REGISTER_RTCOMMAND(RTCommandBenchmarkASTERIXMapping)
+REGISTER_RTCOMMAND(RTCommandBenchmarkKalmanChain)
+REGISTER_RTCOMMAND(RTCommandBenchmarkAssociationWrite)
+
+using namespace std;
+using namespace Utils;
+
+/**
+*/
+void init_benchmark_commands()
+{
+    RTCommandBenchmarkASTERIXMapping::init();
+    RTCommandBenchmarkKalmanChain::init();
+    RTCommandBenchmarkAssociationWrite::init();
+}
+
+/***************************************************************************************
+ * RTCommandBenchmarkASTERIXMapping
+ ***************************************************************************************/
+
+rtcommand::IsValid RTCommandBenchmarkASTERIXMapping::valid() const
+{
+    CHECK_RTCOMMAND_INVALID_CONDITION(!filename_.size(), "Filename empty")
+    CHECK_RTCOMMAND_INVALID_CONDITION(!Files::fileExists(filename_), string("File '")+filename_+"' does not exist")
+
+    return RTCommand::valid();
+}
+
+bool RTCommandBenchmarkASTERIXMapping::run_impl()
+{
+    ASTERIXImportTask& import_task = COMPASS::instance().taskManager().asterixImporterTask();
+
+    auto schema = import_task.schema();
+    if (!schema)
+    {
+        setResultMessage("No ASTERIX parsing schema available");
+        return false;
+    }
+
+    for (auto& map_it : *schema)
+        if (!map_it.second->initialized())
+            map_it.second->initialize();
+
+    // decoded data, either a single jASTERIX JSON object or an array of them
+    std::vector<std::unique_ptr<nlohmann::json>> data;
+
+    try
+    {
+        std::ifstream input_file(filename_);
+        nlohmann::json j = nlohmann::json::parse(input_file);
+
+        if (j.is_array())
+        {
+            for (auto& slice : j)
+                data.emplace_back(new nlohmann::json(std::move(slice)));
+        }
+        else
+        {
+            data.emplace_back(new nlohmann::json(std::move(j)));
+        }
+    }
+    catch (const std::exception& ex)
+    {
+        setResultMessage(string("Could not read file '") + filename_ + "': " + ex.what());
+        return false;
+    }
+
+    if (data.empty() || !data.front())
+    {
+        setResultMessage("File '" + filename_ + "' contains no data");
+        return false;
+    }
+
+    std::vector<std::string> keys;
+
+    if (data.front()->contains("frames"))
+        keys = {"frames", "content", "data_blocks", "content", "records"};
+    else
+        keys = {"data_blocks", "content", "records"};
+
+    loginf << "RTCommandBenchmarkASTERIXMapping: run_impl: benchmarking mapping of file '" << filename_ << "'";
+
+    auto result = ASTERIXJSONMappingJob::benchmarkMapping(data, keys, schema->parsers());
+
+    setJSONReply(result);
+
+    return true;
+}
+
+void RTCommandBenchmarkASTERIXMapping::collectOptions_impl(OptionsDescription& options,
+                                                           PosOptionsDescription& positional)
+{
+    ADD_RTCOMMAND_OPTIONS(options)
+        ("filename,f", po::value<std::string>()->required(), "decoded ASTERIX JSON file, e.g. '/data/decoded.json'");
+
+    ADD_RTCOMMAND_POS_OPTION(positional, "filename")
+}
+
+void RTCommandBenchmarkASTERIXMapping::assignVariables_impl(const VariablesMap& variables)
+{
+    RTCOMMAND_GET_VAR_OR_THROW(variables, "filename", std::string, filename_)
+}
+
+/***************************************************************************************
+ * RTCommandBenchmarkKalmanChain
+ ***************************************************************************************/
+
+rtcommand::IsValid RTCommandBenchmarkKalmanChain::valid() const
+{
+    CHECK_RTCOMMAND_INVALID_CONDITION(num_updates_ < 2, "Number of updates must be at least 2")
+
+    return RTCommand::valid();
+}
+
+bool RTCommandBenchmarkKalmanChain::run_impl()
+{
+    ReconstructorTask& task = COMPASS::instance().taskManager().reconstructReferencesTask();
+
+    ReconstructorBase* reconstructor = task.currentReconstructor();
+    if (!reconstructor)
+    {
+        setResultMessage("No reconstructor available");
+        return false;
+    }
+
+    const auto& settings = reconstructor->referenceCalculatorSettings();
+
+    auto result = reconstruction::KalmanChain::benchmarkReestimate(settings.kalman_type_assoc,
+                                                                   settings.chainEstimatorSettings(),
+                                                                   num_updates_,
+                                                                   num_inserts_);
+
+    auto ratesToJSON = [ ] (const reconstruction::KalmanChain::ReestimateBenchmark::Rates& rates)
+    {
+        nlohmann::json j;
+        j[ "add_per_s"    ] = rates.add_per_s;
+        j[ "insert_per_s" ] = rates.insert_per_s;
+        j[ "ok"           ] = rates.ok;
+        return j;
+    };
+
+    nlohmann::json reply;
+    reply[ "added"              ] = result.num_added;
+    reply[ "inserted"           ] = result.num_inserted;
+    reply[ "fixed_size_kernels" ] = ratesToJSON(result.fixed_size_kernels);
+    reply[ "dynamic_kernels"    ] = ratesToJSON(result.dynamic_kernels);
+    reply[ "max_state_diff"     ] = result.max_state_diff;
+    reply[ "max_cov_diff"       ] = result.max_cov_diff;
+    reply[ "same_results"       ] = result.same_results;
+
+    setJSONReply(reply);
+
+    return true;
+}
+
+void RTCommandBenchmarkKalmanChain::collectOptions_impl(OptionsDescription& options,
+                                                        PosOptionsDescription& positional)
+{
+    ADD_RTCOMMAND_OPTIONS(options)
+        ("updates", po::value<unsigned int>()->default_value(10000), "number of measurements in the synthetic chain")
+        ("inserts", po::value<unsigned int>()->default_value(500), "number of measurements inserted after the initial add");
+}
+
+void RTCommandBenchmarkKalmanChain::assignVariables_impl(const VariablesMap& variables)
+{
+    RTCOMMAND_GET_VAR(variables, "updates", unsigned int, num_updates_)
+    RTCOMMAND_GET_VAR(variables, "inserts", unsigned int, num_inserts_)
+}
+
+/***************************************************************************************
+ * RTCommandBenchmarkAssociationWrite
+ ***************************************************************************************/
+
+rtcommand::IsValid RTCommandBenchmarkAssociationWrite::valid() const
+{
+    CHECK_RTCOMMAND_INVALID_CONDITION(num_rows_ == 0, "Number of rows must be greater than 0")
+
+    return RTCommand::valid();
+}
+
+bool RTCommandBenchmarkAssociationWrite::run_impl()
+{
+    DBInterface& db_interface = COMPASS::instance().dbInterface();
+
+    if (!db_interface.ready())
+    {
+        setResultMessage("No database open");
+        return false;
+    }
+
+    try
+    {
+        auto result = db_interface.benchmarkAssociationWrite(num_rows_, num_rows_row_wise_);
+
+        setJSONReply(result);
+    }
+    catch (const std::exception& ex)
+    {
+        setResultMessage(string("Benchmark failed: ") + ex.what());
+        return false;
+    }
+
+    return true;
+}
+
+void RTCommandBenchmarkAssociationWrite::collectOptions_impl(OptionsDescription& options,
+                                                             PosOptionsDescription& positional)
+{
+    ADD_RTCOMMAND_OPTIONS(options)
+        ("rows", po::value<unsigned int>()->default_value(10000000), "number of written rows")
+        ("row_wise_rows", po::value<unsigned int>()->default_value(10000), "number of rows written via the row-wise update");
+}
+
+void RTCommandBenchmarkAssociationWrite::assignVariables_impl(const VariablesMap& variables)
+{
+    RTCOMMAND_GET_VAR(variables, "rows", unsigned int, num_rows_)
+    RTCOMMAND_GET_VAR(variables, "row_wise_rows", unsigned int, num_rows_row_wise_)
+}
@@ -0,0 +1,83 @@
+/*
+ * This file is part of OpenATS COMPASS.
+ *
+ * COMPASS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * COMPASS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with COMPASS. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "rtcommand/rtcommand.h"
+
+#include <string>
+
+extern void init_benchmark_commands();
+
+/**
+ * benchmark_asterix_mapping --filename /data/decoded_cat048_cat062.json
+ *
+ * Maps the records of a decoded (jASTERIX JSON) ASTERIX file with the generic per-record mapping
+ * and with the mapping plans, and replies the mapping rates of both.
+ */
+struct RTCommandBenchmarkASTERIXMapping : public rtcommand::RTCommand
+{
+    std::string filename_;
+
+    virtual rtcommand::IsValid valid() const override;
+
+protected:
+    virtual bool run_impl() override;
+
+    DECLARE_RTCOMMAND(benchmark_asterix_mapping, "benchmarks the ASTERIX JSON mapping on a decoded ASTERIX JSON file")
+    DECLARE_RTCOMMAND_OPTIONS
+};
+
+/**
+ * benchmark_kalman_chain --updates 10000 --inserts 500
+ *
+ * Reestimates a long synthetic kalman chain with and without fixed-size kalman kernels, using the
+ * chain settings of the current reconstructor, and replies the add and insert rates of both.
+ */
+struct RTCommandBenchmarkKalmanChain : public rtcommand::RTCommand
+{
+    unsigned int num_updates_ = 10000;
+    unsigned int num_inserts_ = 500;
+
+    virtual rtcommand::IsValid valid() const override;
+
+protected:
+    virtual bool run_impl() override;
+
+    DECLARE_RTCOMMAND(benchmark_kalman_chain, "benchmarks kalman chain reestimation on a long synthetic chain")
+    DECLARE_RTCOMMAND_OPTIONS
+};
+
+/**
+ * benchmark_association_write --rows 10000000 --row_wise_rows 10000
+ *
+ * Inserts record numbers into a temporary table of the open database and writes utns to them, via the bulk
+ * update and via the row-wise update used for small ranges, and replies the rates of all steps.
+ */
+struct RTCommandBenchmarkAssociationWrite : public rtcommand::RTCommand
+{
+    unsigned int num_rows_          = 10000000;
+    unsigned int num_rows_row_wise_ = 10000;
+
+    virtual rtcommand::IsValid valid() const override;
+
+protected:
+    virtual bool run_impl() override;
+
+    DECLARE_RTCOMMAND(benchmark_association_write, "benchmarks writing associations to the database")
+    DECLARE_RTCOMMAND_OPTIONS
+};
@@ -45,6 +45,16 @@ ASTERIXDecoderFile::~ASTERIXDecoderFile() = default;
 /**
 */
 void ASTERIXDecoderFile::start_impl()
+{
+    resetProgress();
+
+    while (isRunning() && nextFile())
+        processCurrentFile();
+}
+
+/**
+*/
+void ASTERIXDecoderFile::resetProgress()
 {
     total_file_size_          = source_.totalFileSizeInBytes(true);
     total_records_read_       = 0;
@@ -53,9 +63,48 @@ void ASTERIXDecoderFile::start_impl()
     done_file_size_           = 0;
     
     current_file_idx_         = -1;
+}
 
-    while (isRunning() && nextFile())
-        processCurrentFile();
+/**
+ * Sets the file currently reported as being decoded, for decoders which do not iterate files via nextFile().
+*/
+void ASTERIXDecoderFile::setCurrentFile(int file_idx)
+{
+    assert(file_idx >= 0 && file_idx < (int)source_.file_infos_.size());
+
+    current_file_idx_         = file_idx;
+    current_file_bytes_read_  = 0;
+    current_chunk_bytes_read_ = 0;
+}
+
+/**
+ * Marks the file with the given index as completely decoded.
+*/
+void ASTERIXDecoderFile::fileProcessed(int file_idx)
+{
+    auto& file_info = source_.file_infos_.at(file_idx);
+
+    //another file done
+    done_file_size_          += file_info.sizeInBytes(true);
+    current_file_bytes_read_  = 0;
+    current_chunk_bytes_read_ = 0;
+
+    //flag file as processed
+    file_info.processed = true;
+}
+
+/**
+ * Logs a decode error which occured in the file with the given index.
+*/
+void ASTERIXDecoderFile::fileError(int file_idx, const std::string& err)
+{
+    const auto& file_info = source_.file_infos_.at(file_idx);
+
+    COMPASS::instance().logError("ASTERIX Import") << "file '" << file_info.filename
+                                   << "' decode error '" << err << "'";
+
+    logerr << "ASTERIXDecoderFile: fileError: file '" << file_info.filename << "' decode error '" << err << "'";
+    logError(err);
 }
 
 /**
@@ -96,21 +145,11 @@ void ASTERIXDecoderFile::processCurrentFile()
     {
         processFile(current_file);
 
-        //another file done
-        done_file_size_          += current_file.sizeInBytes(true);
-        current_file_bytes_read_  = 0;
-        current_chunk_bytes_read_ = 0;
-
-        //flag file as processed
-        current_file.processed = true;
+        fileProcessed(current_file_idx_);
     }
     catch(const std::exception& e)
     {
-        COMPASS::instance().logError("ASTERIX Import") << "file '" << current_file.filename
-                                       << "' decode error '" << e.what() << "'";
-
-        logerr << "ASTERIXDecoderFile: processCurrentFile: decode error '" << e.what() << "'";
-        logError(e.what());
+        fileError(current_file_idx_, e.what());
     }
     catch(...)
     {
@@ -77,6 +77,11 @@ protected:
 
     void chunkFinished();
 
+    void resetProgress();
+    void setCurrentFile(int file_idx);
+    void fileProcessed(int file_idx);
+    void fileError(int file_idx, const std::string& err);
+
 private:
     bool nextFile();
     bool atEnd() const;
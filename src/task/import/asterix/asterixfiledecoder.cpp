@@ -22,6 +22,9 @@
 
 #include <jasterix/jasterix.h>
 
+#include <algorithm>
+#include <thread>
+
 using namespace Utils;
 using namespace std;
 using namespace nlohmann;
@@ -41,12 +44,42 @@ ASTERIXFileDecoder::ASTERIXFileDecoder(ASTERIXImportSource& source,
 */
 ASTERIXFileDecoder::~ASTERIXFileDecoder() = default;
 
+/**
+*/
+void ASTERIXFileDecoder::start_impl()
+{
+    std::vector<size_t> file_indices;
+
+    for (size_t i = 0; i < source_.files().size(); ++i)
+        if (source_.files()[ i ].used)
+            file_indices.push_back(i);
+
+    if (!settings().parallel_file_decoding_ ||
+        settings().max_parallel_file_decoders_ < 2 ||
+        file_indices.size() < 2)
+    {
+        ASTERIXDecoderFile::start_impl();
+        return;
+    }
+
+    processFilesParallel(file_indices);
+}
+
 /**
 */
 void ASTERIXFileDecoder::stop_impl()
 {
     // stop decoding
     task().jASTERIX()->stopFileDecoding();
+
+    std::lock_guard<std::mutex> lock(parallel_mutex_);
+
+    parallel_stop_ = true;
+
+    for (auto& jasterix : parallel_jasterix_)
+        jasterix->stopFileDecoding();
+
+    parallel_cv_.notify_all();
 }
 
 /**
@@ -120,52 +153,236 @@ void ASTERIXFileDecoder::processFile(ASTERIXImportFileInfo& file_info)
                                                size_t numErrors) 
     {
         // get last index
+        size_t index;
+        if (lastIndex(*data, index))
+            setFileBytesRead(index);
 
-        if (settings().current_file_framing_ == "")
-        {
-            assert(data->contains("data_blocks"));
-            assert(data->at("data_blocks").is_array());
+        addRecordsRead(num_records);
 
-            if (data->at("data_blocks").size())
-            {
-                json& data_block = data->at("data_blocks").back();
+        //invoke job callback
+        if (job() && !job()->obsolete())
+            job()->fileJasterixCallback(std::move(data), current_file_line, num_frames, num_records, numErrors);
+    };
 
-                assert(data_block.contains("content"));
-                assert(data_block.at("content").is_object());
-                assert(data_block.at("content").contains("index"));
+    //start decoding
+    if (settings().current_file_framing_ == "")
+        task().jASTERIX()->decodeFile(current_filename, callback);
+    else
+        task().jASTERIX()->decodeFile(current_filename, settings().current_file_framing_, callback);
+}
 
-                setFileBytesRead(data_block.at("content").at("index"));
-            }
+/**
+ * Decodes the given files concurrently and passes the decoded chunks on to the job in file order.
+ *
+ * Workers pick the files in order, so the file currently passed on is always being decoded or done,
+ * and the bounded per-file queues limit how far the other workers can decode ahead.
+*/
+void ASTERIXFileDecoder::processFilesParallel(const std::vector<size_t>& file_indices)
+{
+    resetProgress();
+
+    size_t num_workers = std::min((size_t)settings().max_parallel_file_decoders_, file_indices.size());
+
+    loginf << "ASTERIXFileDecoder: processFilesParallel: decoding " << file_indices.size()
+           << " files using " << num_workers << " workers";
+
+    std::vector<FileQueue> queues(file_indices.size());
+    for (size_t i = 0; i < file_indices.size(); ++i)
+        queues[ i ].file_idx = file_indices[ i ];
+
+    {
+        std::lock_guard<std::mutex> lock(parallel_mutex_);
+
+        parallel_stop_ = false;
+        parallel_jasterix_.clear();
+
+        //one fresh jasterix instance per worker
+        for (size_t i = 0; i < num_workers; ++i)
+            parallel_jasterix_.push_back(task().createjASTERIX());
+    }
+
+    std::atomic<size_t> next_queue {0};
+
+    auto worker = [this, &queues, &next_queue] (size_t worker_idx)
+    {
+        jASTERIX::jASTERIX& jasterix = *parallel_jasterix_.at(worker_idx);
+
+        while (!parallel_stop_)
+        {
+            size_t queue_idx = next_queue++;
+            if (queue_idx >= queues.size())
+                break;
+
+            decodeFileParallel(jasterix, queues[ queue_idx ]);
         }
-        else
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < num_workers; ++i)
+        workers.emplace_back(worker, i);
+
+    unsigned int line_id = settings().file_line_id_;
+
+    for (auto& queue : queues)
+    {
+        const auto& file_info = source_.files().at(queue.file_idx);
+
+        setCurrentFile((int)queue.file_idx);
+
+        loginf << "ASTERIXFileDecoder: processFilesParallel: passing on file '" << file_info.filename
+               << "' line " << line_id;
+
+        while (true)
         {
-            assert(data->contains("frames"));
-            assert(data->at("frames").is_array());
+            DecodedChunk chunk;
 
-            if (data->at("frames").size())
             {
-                json& frame = data->at("frames").back();
+                std::unique_lock<std::mutex> lock(parallel_mutex_);
 
-                if (frame.contains("content"))
-                {
-                    assert(frame.at("content").is_object());
-                    assert (frame.at("content").contains("index"));
+                parallel_cv_.wait(lock, [&] { return parallel_stop_ || !queue.chunks.empty() || queue.done; });
 
-                    setFileBytesRead(frame.at("content").at("index"));
-                }
+                if (parallel_stop_ || queue.chunks.empty())
+                    break;
+
+                chunk = std::move(queue.chunks.front());
+                queue.chunks.pop_front();
             }
+
+            parallel_cv_.notify_all(); // queue has space again
+
+            if (chunk.has_index)
+                setFileBytesRead(chunk.index);
+
+            addRecordsRead(chunk.num_records);
+
+            //invoke job callback
+            if (job() && !job()->obsolete())
+                job()->fileJasterixCallback(std::move(chunk.data), line_id, 
+                                            chunk.num_frames, chunk.num_records, chunk.num_errors);
         }
 
-        addRecordsRead(num_records);
+        if (parallel_stop_)
+            break;
 
-        //invoke job callback
+        //make sure the file's data has been fetched before the next file becomes current,
+        //since the data source name is used to detect file changes in timestamp calculation
         if (job() && !job()->obsolete())
-            job()->fileJasterixCallback(std::move(data), current_file_line, num_frames, num_records, numErrors);
+            job()->forceBlockingDataProcessing();
+
+        if (queue.error.size())
+            fileError((int)queue.file_idx, queue.error);
+        else
+            fileProcessed((int)queue.file_idx);
+    }
+
+    for (auto& w : workers)
+        w.join();
+
+    std::lock_guard<std::mutex> lock(parallel_mutex_);
+    parallel_jasterix_.clear();
+}
+
+/**
+ * Decodes the queue's file using the given jasterix instance, runs in a worker thread.
+*/
+void ASTERIXFileDecoder::decodeFileParallel(jASTERIX::jASTERIX& jasterix, FileQueue& queue)
+{
+    const std::string& filename = source_.files().at(queue.file_idx).filename;
+
+    logdbg << "ASTERIXFileDecoder: decodeFileParallel: file '" << filename << "'";
+
+    auto callback = [this, &queue] (std::unique_ptr<nlohmann::json> data, 
+                                    size_t num_frames,
+                                    size_t num_records, 
+                                    size_t num_errors) 
+    {
+        DecodedChunk chunk;
+        chunk.has_index   = lastIndex(*data, chunk.index);
+        chunk.data        = std::move(data);
+        chunk.num_frames  = num_frames;
+        chunk.num_records = num_records;
+        chunk.num_errors  = num_errors;
+
+        std::unique_lock<std::mutex> lock(parallel_mutex_);
+
+        //block until the chunks decoded ahead have been passed on
+        parallel_cv_.wait(lock, [&] { return parallel_stop_ || queue.chunks.size() < MaxQueuedChunksPerFile; });
+
+        if (parallel_stop_)
+            return;
+
+        queue.chunks.push_back(std::move(chunk));
+
+        parallel_cv_.notify_all();
     };
 
-    //start decoding
+    std::string error;
+
+    try
+    {
+        if (settings().current_file_framing_ == "")
+            jasterix.decodeFile(filename, callback);
+        else
+            jasterix.decodeFile(filename, settings().current_file_framing_, callback);
+    }
+    catch(const std::exception& e)
+    {
+        error = e.what();
+    }
+    catch(...)
+    {
+        error = "Unknown decode error";
+    }
+
+    std::lock_guard<std::mutex> lock(parallel_mutex_);
+
+    queue.done  = true;
+    queue.error = error;
+
+    parallel_cv_.notify_all();
+}
+
+/**
+ * Retrieves the file index of the last decoded data block or frame, returns false if not available.
+*/
+bool ASTERIXFileDecoder::lastIndex(const nlohmann::json& data, size_t& index) const
+{
     if (settings().current_file_framing_ == "")
-        task().jASTERIX()->decodeFile(current_filename, callback);
+    {
+        assert(data.contains("data_blocks"));
+        assert(data.at("data_blocks").is_array());
+
+        if (data.at("data_blocks").size())
+        {
+            const json& data_block = data.at("data_blocks").back();
+
+            assert(data_block.contains("content"));
+            assert(data_block.at("content").is_object());
+            assert(data_block.at("content").contains("index"));
+
+            index = data_block.at("content").at("index");
+            return true;
+        }
+    }
     else
-        task().jASTERIX()->decodeFile(current_filename, settings().current_file_framing_, callback);
+    {
+        assert(data.contains("frames"));
+        assert(data.at("frames").is_array());
+
+        if (data.at("frames").size())
+        {
+            const json& frame = data.at("frames").back();
+
+            if (frame.contains("content"))
+            {
+                assert(frame.at("content").is_object());
+                assert (frame.at("content").contains("index"));
+
+                index = frame.at("content").at("index");
+                return true;
+            }
+        }
+    }
+
+    return false;
 }
@@ -21,8 +21,26 @@
 
 #include <boost/date_time/posix_time/posix_time.hpp>
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace jASTERIX
+{
+class jASTERIX;
+}
+
 /**
-*/
+ * Decoder for ASTERIX recording files.
+ *
+ * If parallel file decoding is enabled, several files are decoded concurrently, each by a worker thread
+ * with its own jASTERIX instance. The decoded chunks are queued per file and passed on to the decode job
+ * strictly in file order, so that post-processing, mapping and timestamp calculation see the same data
+ * sequence as in serial decoding.
+ */
 class ASTERIXFileDecoder : public ASTERIXDecoderFile
 {
 public:
@@ -32,9 +50,42 @@ public:
 
     std::string name() const override final { return "ASTERIXFileDecoder"; }
 
+    static const size_t MaxQueuedChunksPerFile = 4;
+
 protected:
+    void start_impl() override final;
     void stop_impl() override final;
 
     bool checkDecoding(ASTERIXImportFileInfo& file_info, int section_idx, std::string& error) const override final;
     void processFile(ASTERIXImportFileInfo& file_info) override final;
+
+private:
+    struct DecodedChunk
+    {
+        std::unique_ptr<nlohmann::json> data;
+        size_t num_frames  = 0;
+        size_t num_records = 0;
+        size_t num_errors  = 0;
+        bool   has_index   = false;
+        size_t index       = 0;
+    };
+
+    struct FileQueue
+    {
+        size_t                   file_idx = 0;
+        std::deque<DecodedChunk> chunks;
+        bool                     done     = false;
+        std::string              error;
+    };
+
+    void processFilesParallel(const std::vector<size_t>& file_indices);
+    void decodeFileParallel(jASTERIX::jASTERIX& jasterix, FileQueue& queue);
+
+    bool lastIndex(const nlohmann::json& data, size_t& index) const;
+
+    std::mutex              parallel_mutex_;
+    std::condition_variable parallel_cv_;
+    std::atomic<bool>       parallel_stop_ {false};
+
+    std::vector<std::shared_ptr<jASTERIX::jASTERIX>> parallel_jasterix_;
 };
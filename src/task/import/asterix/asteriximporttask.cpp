@@ -83,11 +83,15 @@ ASTERIXImportTaskSettings::ASTERIXImportTaskSettings()
     ,   file_line_id_             (0)
     ,   date_str_                 ()
     ,   network_ignore_future_ts_ (false)
+    ,   network_max_latency_ms_   (1000)
     ,   obfuscate_secondary_info_ (false)
     ,   date_                     ()
     ,   max_network_lines_        (4)
     ,   chunk_size_jasterix       (2000)
     ,   chunk_size_insert         (50000)
+    ,   use_mapping_plans_        (true)
+    ,   parallel_file_decoding_   (false)
+    ,   max_parallel_file_decoders_(4)
 {
 }
 
@@ -153,12 +157,19 @@ ASTERIXImportTask::ASTERIXImportTask(const std::string& class_id,
     registerParameter("network_ignore_future_ts", &settings_.network_ignore_future_ts_,
                       ASTERIXImportTaskSettings().network_ignore_future_ts_);
     addJSONExportFilter(JSONExportType::General, JSONExportFilterType::ParamID, "network_ignore_future_ts");
+    registerParameter("network_max_latency_ms", &settings_.network_max_latency_ms_,
+                      ASTERIXImportTaskSettings().network_max_latency_ms_);
     registerParameter("obfuscate_secondary_info", &settings_.obfuscate_secondary_info_,
                       ASTERIXImportTaskSettings().obfuscate_secondary_info_);
     addJSONExportFilter(JSONExportType::General, JSONExportFilterType::ParamID, "obfuscate_secondary_info");
 
     registerParameter("chunk_size_jasterix", &settings_.chunk_size_jasterix, ASTERIXImportTaskSettings().chunk_size_jasterix);
     registerParameter("chunk_size_insert", &settings_.chunk_size_insert, ASTERIXImportTaskSettings().chunk_size_insert);
+    registerParameter("use_mapping_plans", &settings_.use_mapping_plans_, ASTERIXImportTaskSettings().use_mapping_plans_);
+    registerParameter("parallel_file_decoding", &settings_.parallel_file_decoding_,
+                      ASTERIXImportTaskSettings().parallel_file_decoding_);
+    registerParameter("max_parallel_file_decoders", &settings_.max_parallel_file_decoders_,
+                      ASTERIXImportTaskSettings().max_parallel_file_decoders_);
 
     std::string jasterix_definition_path = HOME_DATA_DIRECTORY + "jasterix_definitions";
 
@@ -388,14 +399,7 @@ std::shared_ptr<jASTERIX::jASTERIX> ASTERIXImportTask::jASTERIX(bool refresh) co
 */
 void ASTERIXImportTask::refreshjASTERIX() const
 {
-    std::string jasterix_definition_path = HOME_DATA_DIRECTORY + "jasterix_definitions";
-
-    logdbg << "ASTERIXImportTask: refreshjASTERIX: jasterix definition path '"
-           << jasterix_definition_path << "'";
-    assert(Files::directoryExists(jasterix_definition_path));
-
-    jasterix_ = std::make_shared<jASTERIX::jASTERIX>(jasterix_definition_path, false,
-                                                     settings_.debug_jasterix_, true);
+    jasterix_ = createjASTERIX();
 
     std::vector<std::string> framings = jasterix_->framings();
     if (std::find(framings.begin(), framings.end(), settings_.current_file_framing_) == framings.end())
@@ -406,57 +410,75 @@ void ASTERIXImportTask::refreshjASTERIX() const
         ASTERIXImportTaskSettings& settings = const_cast<ASTERIXImportTaskSettings&>(settings_);
         settings.current_file_framing_ = "";
     }
+}
+
+/**
+ * Creates a new jASTERIX instance configured with the current category settings,
+ * e.g. to decode several files concurrently.
+ */
+std::shared_ptr<jASTERIX::jASTERIX> ASTERIXImportTask::createjASTERIX() const
+{
+    std::string jasterix_definition_path = HOME_DATA_DIRECTORY + "jasterix_definitions";
+
+    logdbg << "ASTERIXImportTask: createjASTERIX: jasterix definition path '"
+           << jasterix_definition_path << "'";
+    assert(Files::directoryExists(jasterix_definition_path));
+
+    auto jasterix = std::make_shared<jASTERIX::jASTERIX>(jasterix_definition_path, false,
+                                                         settings_.debug_jasterix_, true);
 
     // set category configs
-    jasterix_->decodeNoCategories();
+    jasterix->decodeNoCategories();
 
     for (auto& cat_it : category_configs_)
     {
         // loginf << "ASTERIXImportTask: importFile: setting category " << cat_it.first;
 
-        logdbg << "ASTERIXImportTask: refreshjASTERIX: setting cat " << cat_it.first << " decode "
+        logdbg << "ASTERIXImportTask: createjASTERIX: setting cat " << cat_it.first << " decode "
                << cat_it.second.decode() << " edition '" << cat_it.second.edition() << "' ref '"
                << cat_it.second.ref() << "'";
 
-        if (!jasterix_->hasCategory(cat_it.first))
+        if (!jasterix->hasCategory(cat_it.first))
         {
-            logwrn << "ASTERIXImportTask: refreshjASTERIX: cat '" << cat_it.first
+            logwrn << "ASTERIXImportTask: createjASTERIX: cat '" << cat_it.first
                    << "' not defined in decoder";
             continue;
         }
 
-        if (!jasterix_->category(cat_it.first)->hasEdition(cat_it.second.edition()))
+        if (!jasterix->category(cat_it.first)->hasEdition(cat_it.second.edition()))
         {
-            logwrn << "ASTERIXImportTask: refreshjASTERIX: cat " << cat_it.first << " edition '"
+            logwrn << "ASTERIXImportTask: createjASTERIX: cat " << cat_it.first << " edition '"
                    << cat_it.second.edition() << "' not defined in decoder";
             continue;
         }
 
         if (cat_it.second.ref().size() &&  // only if value set
-            !jasterix_->category(cat_it.first)->hasREFEdition(cat_it.second.ref()))
+            !jasterix->category(cat_it.first)->hasREFEdition(cat_it.second.ref()))
         {
-            logwrn << "ASTERIXImportTask: refreshjASTERIX: cat " << cat_it.first << " ref '"
+            logwrn << "ASTERIXImportTask: createjASTERIX: cat " << cat_it.first << " ref '"
                    << cat_it.second.ref() << "' not defined in decoder";
             continue;
         }
 
         if (cat_it.second.spf().size() &&  // only if value set
-            !jasterix_->category(cat_it.first)->hasSPFEdition(cat_it.second.spf()))
+            !jasterix->category(cat_it.first)->hasSPFEdition(cat_it.second.spf()))
         {
-            logwrn << "ASTERIXImportTask: refreshjASTERIX: cat " << cat_it.first << " spf '"
+            logwrn << "ASTERIXImportTask: createjASTERIX: cat " << cat_it.first << " spf '"
                    << cat_it.second.spf() << "' not defined in decoder";
             continue;
         }
 
         //        loginf << "ASTERIXImportTask: importFile: setting cat " <<  cat_it.first
         //               << " decode flag " << cat_it.second.decode();
-        jasterix_->setDecodeCategory(cat_it.first, cat_it.second.decode());
-        logdbg << "ASTERIXImportTask: refreshjASTERIX: setting cat " <<  cat_it.first
+        jasterix->setDecodeCategory(cat_it.first, cat_it.second.decode());
+        logdbg << "ASTERIXImportTask: createjASTERIX: setting cat " <<  cat_it.first
                << " edition " << cat_it.second.edition();
-        jasterix_->category(cat_it.first)->setCurrentEdition(cat_it.second.edition());
-        jasterix_->category(cat_it.first)->setCurrentREFEdition(cat_it.second.ref());
-        jasterix_->category(cat_it.first)->setCurrentSPFEdition(cat_it.second.spf());
+        jasterix->category(cat_it.first)->setCurrentEdition(cat_it.second.edition());
+        jasterix->category(cat_it.first)->setCurrentREFEdition(cat_it.second.ref());
+        jasterix->category(cat_it.first)->setCurrentSPFEdition(cat_it.second.spf());
     }
+
+    return jasterix;
 }
 
 /**
@@ -728,6 +750,7 @@ void ASTERIXImportTask::reset()
     num_packets_in_processing_ = 0;
     num_packets_total_         = 0;
     num_records_               = 0;
+    total_insert_time_ms_      = 0;
 
     current_data_source_name_ = "";
 
@@ -769,27 +792,24 @@ void ASTERIXImportTask::stop()
     {
         loginf << "ASTERIXImportTask: stop: waiting for decode job to finish";
 
-        QCoreApplication::processEvents(QEventLoop::ExcludeUserInputEvents);
-
-        QThread::msleep(1);
+        // job done signals are posted as events, so wait for them instead of spinning
+        QCoreApplication::processEvents(QEventLoop::ExcludeUserInputEvents | QEventLoop::WaitForMoreEvents);
     }
 
     while(json_map_jobs_.size())
     {
         loginf << "ASTERIXImportTask: stop: waiting for map job to finish";
 
-        QCoreApplication::processEvents(QEventLoop::ExcludeUserInputEvents);
-
-        QThread::msleep(1);
+        // job done signals are posted as events, so wait for them instead of spinning
+        QCoreApplication::processEvents(QEventLoop::ExcludeUserInputEvents | QEventLoop::WaitForMoreEvents);
     }
 
     while(postprocess_jobs_.size())
     {
         loginf << "ASTERIXImportTask: stop: waiting for post-process job to finish";
 
-        QCoreApplication::processEvents(QEventLoop::ExcludeUserInputEvents);
-
-        QThread::msleep(1);
+        // job done signals are posted as events, so wait for them instead of spinning
+        QCoreApplication::processEvents(QEventLoop::ExcludeUserInputEvents | QEventLoop::WaitForMoreEvents);
     }
 
     loginf << "ASTERIXImportTask: stop done";
@@ -1012,7 +1032,8 @@ void ASTERIXImportTask::addDecodedASTERIXSlot()
         keys = {"frames", "content", "data_blocks", "content", "records"};
 
     std::shared_ptr<ASTERIXJSONMappingJob> json_map_job =
-        make_shared<ASTERIXJSONMappingJob>(std::move(extracted_data), source_name, keys, schema_->parsers());
+        make_shared<ASTERIXJSONMappingJob>(std::move(extracted_data), source_name, keys, schema_->parsers(),
+                                           settings_.use_mapping_plans_);
 
     json_map_jobs_.push_back(json_map_job);
 
@@ -1402,7 +1423,7 @@ void ASTERIXImportTask::insertData()
         insert_slot_connected_ = true;
     }
 
-    //insert_start_time_ = boost::posix_time::microsec_clock::local_time();
+    insert_start_time_ = boost::posix_time::microsec_clock::local_time();
 
     dbcont_manager.insertData(job_buffers);
 
@@ -1433,13 +1454,8 @@ void ASTERIXImportTask::insertDoneSlot()
 
     --num_packets_in_processing_;
 
-    //    double insert_time_ms = (double)(
-    //                boost::posix_time::microsec_clock::local_time() - insert_start_time_).total_microseconds() / 1000.0;
-
-    //    total_insert_time_ms_ += insert_time_ms;
-
-    //    loginf << "UGA insert time " << insert_time_ms
-    //           << " ms total " << total_insert_time_ms_/1000.0 << " s" ;
+    total_insert_time_ms_ += (double)(
+                boost::posix_time::microsec_clock::local_time() - insert_start_time_).total_microseconds() / 1000.0;
 
     if (queued_insert_buffers_.size())
     {
@@ -1526,6 +1542,13 @@ void ASTERIXImportTask::checkAllDone()
 
         int records_per_second = num_records_ / std::max(1.0, time_diff.total_milliseconds() / 1000.0);
 
+        // db insert rate, used to compare insert methods (e.g. chunk-wise vs. row-wise appends)
+        double insert_time_s = total_insert_time_ms_ / 1000.0;
+
+        loginf << "ASTERIXImportTask: checkAllDone: inserted " << num_records_ << " record(s) in "
+               << String::timeStringFromDouble(insert_time_s, false) << " ("
+               << (insert_time_s > 0 ? (size_t)(num_records_ / insert_time_s) : 0) << " rec/s insert rate)";
+
         COMPASS::instance().logInfo("ASTERIX Import")
             << " finished after "
             << String::timeStringFromDouble(time_diff.total_milliseconds() / 1000.0, false)
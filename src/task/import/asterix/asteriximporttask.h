@@ -98,6 +98,7 @@ public:
     std::string date_str_;
 
     bool network_ignore_future_ts_;
+    unsigned int network_max_latency_ms_; // max time received network data is buffered before decoding
 
     bool obfuscate_secondary_info_;
 
@@ -110,6 +111,12 @@ public:
     unsigned int chunk_size_insert;
 
     unsigned int max_packets_in_processing_{5};
+
+    bool use_mapping_plans_; // map records using pre-compiled buffer mapping plans
+
+    bool parallel_file_decoding_; // decode several files concurrently, each using its own jASTERIX instance
+    unsigned int max_parallel_file_decoders_;
+
 };
 
 /**
@@ -166,6 +173,7 @@ public:
     bool requiresFixedFraming() const;
 
     std::shared_ptr<jASTERIX::jASTERIX> jASTERIX(bool refresh = false) const;
+    std::shared_ptr<jASTERIX::jASTERIX> createjASTERIX() const;
     
     bool hasConfiguratonFor(unsigned int category);
     bool decodeCategory(unsigned int category);
@@ -248,8 +256,8 @@ protected:
     std::string error_message_;
 
     bool insert_active_{false};
-    //boost::posix_time::ptime insert_start_time_;
-    //double total_insert_time_ms_ {0};
+    boost::posix_time::ptime insert_start_time_;
+    double total_insert_time_ms_ {0};
 
     std::set<int> added_data_sources_;
 
@@ -1,5 +1,6 @@
 #include "asterixjsonmappingjob.h"
 #include "asterixjsonparser.h"
+#include "jsonmappingplan.h"
 #include "buffer.h"
 //#include "dbcontent/dbcontent.h"
 #include "json_tools.h"
@@ -17,12 +18,14 @@ using namespace nlohmann;
 ASTERIXJSONMappingJob::ASTERIXJSONMappingJob(std::vector<std::unique_ptr<nlohmann::json>> data,
                                              const std::string& source_name,
                                              const std::vector<std::string>& data_record_keys,
-                                             const std::map<unsigned int, std::unique_ptr<ASTERIXJSONParser>>& parsers)
+                                             const std::map<unsigned int, std::unique_ptr<ASTERIXJSONParser>>& parsers,
+                                             bool use_mapping_plans)
     : Job("ASTERIXJSONMappingJob"),
     data_(std::move(data)),
     source_name_(source_name),
     data_record_keys_(data_record_keys),
-    parsers_(parsers)
+    parsers_(parsers),
+    use_mapping_plans_(use_mapping_plans)
 {
     logdbg << "ASTERIXJSONMappingJob: ctor";
 }
@@ -40,16 +43,14 @@ void ASTERIXJSONMappingJob::run_impl()
 
     started_ = true;
 
-    string dbcontent_name;
+    buffers_ = createBuffers(parsers_);
 
-    for (auto& parser_it : parsers_)
+    // compile plans after all variables were added, since they reference the buffer columns
+    if (use_mapping_plans_)
     {
-        dbcontent_name = parser_it.second->dbContentName();
-
-        if (!buffers_.count(dbcontent_name))
-            buffers_[dbcontent_name] = parser_it.second->getNewBuffer();
-        else
-            parser_it.second->appendVariablesToBuffer(*buffers_.at(dbcontent_name));
+        for (auto& parser_it : parsers_)
+            mapping_plans_[parser_it.first] =
+                parser_it.second->createMappingPlan(*buffers_.at(parser_it.second->dbContentName()));
     }
 
     auto process_lambda = [this](nlohmann::json& record) 
@@ -90,7 +91,10 @@ void ASTERIXJSONMappingJob::run_impl()
         {
             logdbg << "ASTERIXJSONMappingJob: run: obj " << dbcontent_name << " parsing JSON";
 
-            parsed = parser->parseJSON(record, *buffer);
+            if (use_mapping_plans_)
+                parsed = parser->parseJSON(record, *mapping_plans_.at(category));
+            else
+                parsed = parser->parseJSON(record, *buffer);
 
             logdbg << "ASTERIXJSONMappingJob: run: obj " << dbcontent_name << " done";
 
@@ -141,6 +145,7 @@ void ASTERIXJSONMappingJob::run_impl()
     }
     buffers_ = not_empty_buffers;  // cleaner
 
+    mapping_plans_.clear();
     data_.clear();
 
     done_ = true;
@@ -157,6 +162,130 @@ void ASTERIXJSONMappingJob::run_impl()
            << num_not_mapped_;
 }
 
+std::map<std::string, std::shared_ptr<Buffer>> ASTERIXJSONMappingJob::createBuffers(
+    const std::map<unsigned int, std::unique_ptr<ASTERIXJSONParser>>& parsers)
+{
+    std::map<std::string, std::shared_ptr<Buffer>> buffers;
+
+    string dbcontent_name;
+
+    for (auto& parser_it : parsers)
+    {
+        dbcontent_name = parser_it.second->dbContentName();
+
+        if (!buffers.count(dbcontent_name))
+            buffers[dbcontent_name] = parser_it.second->getNewBuffer();
+        else
+            parser_it.second->appendVariablesToBuffer(*buffers.at(dbcontent_name));
+    }
+
+    return buffers;
+}
+
+/**
+ * Maps all records with both the generic per-record mapping (ASTERIXJSONParser::parseJSON on the buffer)
+ * and the mapping plans into separate buffers, and checks that both results are identical.
+ * Not used during import, see the benchmark_asterix_mapping command.
+ * Returns the number of mapped records, the rates of both mapping paths and the comparison result.
+ */
+nlohmann::json ASTERIXJSONMappingJob::benchmarkMapping(
+    std::vector<std::unique_ptr<nlohmann::json>>& data,
+    const std::vector<std::string>& data_record_keys,
+    const std::map<unsigned int, std::unique_ptr<ASTERIXJSONParser>>& parsers)
+{
+    std::map<std::string, std::shared_ptr<Buffer>> generic_buffers = createBuffers(parsers);
+    std::map<std::string, std::shared_ptr<Buffer>> plan_buffers = createBuffers(parsers);
+
+    std::map<unsigned int, std::unique_ptr<JSONMappingPlan>> plans;
+
+    for (auto& parser_it : parsers)
+        plans[parser_it.first] =
+            parser_it.second->createMappingPlan(*plan_buffers.at(parser_it.second->dbContentName()));
+
+    size_t num_records {0};
+    size_t num_errors {0};
+    bool use_plans {false};
+
+    auto map_lambda = [&parsers, &generic_buffers, &plans, &num_records, &num_errors, &use_plans](nlohmann::json& record)
+    {
+        if (!record.contains("category"))
+            return;
+
+        unsigned int category = record.at("category");
+
+        if (!parsers.count(category))
+            return;
+
+        const unique_ptr<ASTERIXJSONParser>& parser = parsers.at(category);
+
+        ++num_records;
+
+        try
+        {
+            if (use_plans)
+                parser->parseJSON(record, *plans.at(category));
+            else
+                parser->parseJSON(record, *generic_buffers.at(parser->dbContentName()));
+        }
+        catch (exception&)
+        {
+            ++num_errors;
+        }
+    };
+
+    auto run_lambda = [&data, &data_record_keys, &map_lambda, &num_records, &num_errors] ()
+    {
+        num_records = 0;
+        num_errors  = 0;
+
+        boost::posix_time::ptime start_time = boost::posix_time::microsec_clock::local_time();
+
+        for (auto& data_slice : data)
+        {
+            if (data_slice)
+                JSON::applyFunctionToValues(*data_slice.get(), data_record_keys, data_record_keys.begin(),
+                                            map_lambda, false);
+        }
+
+        auto t_diff = boost::posix_time::microsec_clock::local_time() - start_time;
+
+        return t_diff.total_microseconds() ? t_diff.total_microseconds() / 1E6 : 1E-6;
+    };
+
+    use_plans = false;
+    double generic_secs = run_lambda();
+
+    use_plans = true;
+    double plan_secs = run_lambda();
+
+    bool same = true;
+
+    for (auto& buf_it : generic_buffers)
+    {
+        if (buf_it.second->asJSON() != plan_buffers.at(buf_it.first)->asJSON())
+        {
+            logerr << "ASTERIXJSONMappingJob: benchmarkMapping: results differ for " << buf_it.first;
+            same = false;
+        }
+    }
+
+    loginf << "ASTERIXJSONMappingJob: benchmarkMapping: " << num_records << " records:"
+           << " generic " << String::doubleToStringPrecision(num_records / generic_secs, 0) << " rec/s"
+           << " plan " << String::doubleToStringPrecision(num_records / plan_secs, 0) << " rec/s"
+           << " speedup " << String::doubleToStringPrecision(generic_secs / plan_secs, 2)
+           << " same " << same;
+
+    nlohmann::json result;
+    result["records"          ] = num_records;
+    result["errors"           ] = num_errors;
+    result["generic_rec_per_s"] = num_records / generic_secs;
+    result["plan_rec_per_s"   ] = num_records / plan_secs;
+    result["speedup"          ] = generic_secs / plan_secs;
+    result["same_results"     ] = same;
+
+    return result;
+}
+
 std::string ASTERIXJSONMappingJob::sourceName() const
 {
     return source_name_;
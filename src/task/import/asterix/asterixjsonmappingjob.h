@@ -10,6 +10,7 @@
 
 class ASTERIXJSONParser;
 class Buffer;
+class JSONMappingPlan;
 
 class ASTERIXJSONMappingJob : public Job
 {
@@ -17,7 +18,8 @@ class ASTERIXJSONMappingJob : public Job
     ASTERIXJSONMappingJob(std::vector<std::unique_ptr<nlohmann::json>> data,
                             const std::string& source_name,
                             const std::vector<std::string>& data_record_keys,
-                            const std::map<unsigned int, std::unique_ptr<ASTERIXJSONParser>>& parsers);
+                            const std::map<unsigned int, std::unique_ptr<ASTERIXJSONParser>>& parsers,
+                            bool use_mapping_plans = true);
       // json obj moved, mappings referenced
     virtual ~ASTERIXJSONMappingJob();
 
@@ -32,6 +34,10 @@ class ASTERIXJSONMappingJob : public Job
 
     std::string sourceName() const;
 
+    static nlohmann::json benchmarkMapping(std::vector<std::unique_ptr<nlohmann::json>>& data,
+                                           const std::vector<std::string>& data_record_keys,
+                                           const std::map<unsigned int, std::unique_ptr<ASTERIXJSONParser>>& parsers);
+
 protected:
     void run_impl() override;
 
@@ -50,7 +56,13 @@ private:
 
     const std::map<unsigned int, std::unique_ptr<ASTERIXJSONParser>>& parsers_;
 
+    bool use_mapping_plans_ {true}; // false uses generic per-record mapping
+    std::map<unsigned int, std::unique_ptr<JSONMappingPlan>> mapping_plans_; // category -> plan
+
     std::map<std::string, std::shared_ptr<Buffer>> buffers_;
+
+    static std::map<std::string, std::shared_ptr<Buffer>> createBuffers(
+        const std::map<unsigned int, std::unique_ptr<ASTERIXJSONParser>>& parsers);
 };
 
 
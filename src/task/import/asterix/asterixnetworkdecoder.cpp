@@ -28,6 +28,8 @@
 #include <boost/thread.hpp>
 #include <boost/interprocess/sync/scoped_lock.hpp>
 
+#include <algorithm>
+
 using namespace nlohmann;
 using namespace Utils;
 using namespace std;
@@ -87,6 +89,9 @@ void ASTERIXNetworkDecoder::start_impl()
 
     loginf << "ASTERIXNetworkDecoder: start: max lines " << max_lines;
 
+    receive_buffers_.clear();
+    receive_bytes_dropped_.clear();
+
     for (auto& ds_it : ds_lines_)
     {
         //loginf << ds_it.first << ":";
@@ -102,6 +107,11 @@ void ASTERIXNetworkDecoder::start_impl()
             loginf << "ASTERIXNetworkDecoder: start: setting up ds_id " << ds_it.first
                    << " line " << line << " info " << line_it.second->asString();
 
+            // lines of all data sources are received in the single io context thread,
+            // so there is only one producer per receive buffer
+            if (!receive_buffers_.count(line))
+                receive_buffers_[line].reset(new SPSCRingBuffer(MAX_ALL_RECEIVE_SIZE));
+
             auto data_callback = [this,line](const char* data, unsigned int length) {
                 this->storeReceivedData(line, data, length);
             };
@@ -122,95 +132,136 @@ void ASTERIXNetworkDecoder::start_impl()
 
     last_receive_decode_time_ = boost::posix_time::microsec_clock::local_time();
 
-    unsigned int line_id = 0;
+    boost::posix_time::time_duration max_latency =
+        boost::posix_time::milliseconds(std::max(1u, settings().network_max_latency_ms_));
+
+    loginf << "ASTERIXNetworkDecoder: start: max latency " << max_latency.total_milliseconds() << "ms";
 
     while (isRunning())
     {
-        receive_semaphore_.wait();
+        // wait until flush is due, woken up early on stop or if a receive buffer fills up
+        boost::posix_time::ptime flush_time = last_receive_decode_time_ + max_latency;
+        boost::posix_time::time_duration wait_time =
+            flush_time - boost::posix_time::microsec_clock::local_time();
+
+        if (wait_time.is_negative())
+            wait_time = boost::posix_time::time_duration(0, 0, 0);
+
+        receive_semaphore_.timed_wait(boost::posix_time::microsec_clock::universal_time() + wait_time);
 
         if (!isRunning())
             break;
 
-        {
-            boost::mutex::scoped_lock lock(receive_buffers_mutex_);
+        boost::posix_time::ptime now = boost::posix_time::microsec_clock::local_time();
 
-            if (receive_buffer_sizes_.size() // not paused, any data received, 1sec passed
-                    && (boost::posix_time::microsec_clock::local_time()
-                        - last_receive_decode_time_).total_milliseconds() > 1000)
-            {
-                logdbg << "ASTERIXNetworkDecoder: start: copying data "
-                       << receive_buffer_sizes_.size() << " buffers  max " << MAX_ALL_RECEIVE_SIZE;
+        bool flush = now >= flush_time;
 
-                // copy data
-                for (auto& size_it : receive_buffer_sizes_)
-                {
-                    line_id = size_it.first;
+        if (!flush) // woken up early
+        {
+            for (auto& buf_it : receive_buffers_)
+                flush |= buf_it.second->size() > buf_it.second->capacity() / 2;
+        }
 
-                    assert (receive_buffers_.count(line_id));
+        if (!flush)
+            continue;
 
-                    assert (receive_buffer_sizes_.at(line_id) <= MAX_ALL_RECEIVE_SIZE);
+        last_receive_decode_time_ = now;
 
-                    if (!receive_buffers_copy_.count(line_id))
-                        receive_buffers_copy_[line_id].reset(new boost::array<char, MAX_ALL_RECEIVE_SIZE>());
+        bool decoded = decodeReceivedData();
 
-                    *receive_buffers_copy_.at(line_id) = *receive_buffers_.at(line_id);
-                    receive_copy_buffer_sizes_[line_id] = size_it.second;
+        updateReceiveCounters();
 
-                }
+        if (decoded && job() && !job()->obsolete())
+            job()->forceBlockingDataProcessing();
+    }
 
-                receive_buffer_sizes_.clear();
+    loginf << "ASTERIXNetworkDecoder: start: shutting down iocontext";
 
-                lock.unlock();
+    io_context.stop();
+    assert (io_context.stopped());
 
-                last_receive_decode_time_ = boost::posix_time::microsec_clock::local_time();
+    t.timed_join(100);
 
-                logdbg << "ASTERIXNetworkDecoder: start: processing copied data";
+    //done_ = true; // done set in outer run function
 
-                for (auto& size_it : receive_copy_buffer_sizes_)
-                {
-                    line_id = size_it.first;
+    loginf << "ASTERIXNetworkDecoder: start: done";
+}
 
-                    assert (receive_buffers_copy_.count(line_id));
+/**
+*/
+void ASTERIXNetworkDecoder::stop_impl()
+{
+    // stop decoding
+    receive_semaphore_.post(); // wake up loop
+}
 
-                    auto callback = [this, line_id](std::unique_ptr<nlohmann::json> data, size_t num_frames,
-                            size_t num_records, size_t numErrors) {
+/**
+ * Decodes all data currently stored in the receive buffers in place, returns if any data was decoded.
+*/
+bool ASTERIXNetworkDecoder::decodeReceivedData()
+{
+    bool decoded = false;
 
-                        if (job() && !job()->obsolete())
-                            job()->netJasterixCallback(std::move(data), line_id, num_frames, num_records, numErrors);
-                    };
+    for (auto& buf_it : receive_buffers_)
+    {
+        unsigned int line_id = buf_it.first;
+        SPSCRingBuffer& buffer = *buf_it.second;
 
-                    task().jASTERIX()->decodeData((char*) receive_buffers_copy_.at(line_id)->data(),
-                                                   size_it.second, callback);
-                }
+        auto callback = [this, line_id](std::unique_ptr<nlohmann::json> data, size_t num_frames,
+                size_t num_records, size_t numErrors) {
 
-                logdbg << "ASTERIXNetworkDecoder: start: done";
+            if (job() && !job()->obsolete())
+                job()->netJasterixCallback(std::move(data), line_id, num_frames, num_records, numErrors);
+        };
 
-                receive_copy_buffer_sizes_.clear();
+        // data available now lies in at most two regions, later received data is decoded in the next flush
+        for (unsigned int region_cnt = 0; region_cnt < 2; ++region_cnt)
+        {
+            auto region = buffer.readRegion();
 
-                if (job() && !job()->obsolete())
-                    job()->forceBlockingDataProcessing();
-            }
-        }
-    }
+            if (!region.second)
+                break;
 
-    loginf << "ASTERIXNetworkDecoder: start: shutting down iocontext";
+            logdbg << "ASTERIXNetworkDecoder: decodeReceivedData: line " << line_id
+                   << " decoding " << region.second << " bytes";
 
-    io_context.stop();
-    assert (io_context.stopped());
+            task().jASTERIX()->decodeData((char*) region.first, region.second, callback);
 
-    t.timed_join(100);
+            buffer.release(region.second);
 
-    //done_ = true; // done set in outer run function
+            decoded = true;
+        }
+    }
 
-    loginf << "ASTERIXNetworkDecoder: start: done";
+    return decoded;
 }
 
 /**
 */
-void ASTERIXNetworkDecoder::stop_impl()
+void ASTERIXNetworkDecoder::updateReceiveCounters()
 {
-    // stop decoding
-    receive_semaphore_.post(); // wake up loop
+    size_t bytes_received = 0;
+    size_t bytes_dropped  = 0;
+
+    for (auto& buf_it : receive_buffers_)
+    {
+        size_t line_dropped = buf_it.second->bytesDropped();
+
+        if (line_dropped > receive_bytes_dropped_[buf_it.first])
+        {
+            logerr << "ASTERIXNetworkDecoder: updateReceiveCounters: overload on line " << buf_it.first + 1
+                   << ", dropped " << line_dropped - receive_bytes_dropped_[buf_it.first]
+                   << " bytes, total " << line_dropped;
+
+            receive_bytes_dropped_[buf_it.first] = line_dropped;
+        }
+
+        bytes_received += buf_it.second->bytesWritten();
+        bytes_dropped  += line_dropped;
+    }
+
+    bytes_received_ = bytes_received;
+    bytes_dropped_  = bytes_dropped;
 }
 
 /**
@@ -224,25 +275,15 @@ void ASTERIXNetworkDecoder::storeReceivedData(unsigned int line,
 
     //loginf << "ASTERIXDecoderBase: storeReceivedData: sender " << sender_id;
 
-    boost::mutex::scoped_lock lock(receive_buffers_mutex_);
-
-    if (length + receive_buffer_sizes_[line] >= MAX_ALL_RECEIVE_SIZE)
-    {
-        logerr << "ASTERIXNetworkDecoder: storeReceivedData: overload, too much data in buffer";
-        return;
-    }
-
-    if (!receive_buffers_.count(line))
-        receive_buffers_[line].reset(new boost::array<char, MAX_ALL_RECEIVE_SIZE>());
+    auto it = receive_buffers_.find(line);
+    assert (it != receive_buffers_.end());
 
-    assert (receive_buffers_[line]);
+    SPSCRingBuffer& buffer = *it->second;
 
-    for (unsigned int cnt=0; cnt < length; ++cnt)
-        receive_buffers_[line]->at(receive_buffer_sizes_[line]+cnt) = data[cnt];
-
-    receive_buffer_sizes_[line] += length;
-
-    lock.unlock();
+    if (!buffer.write(data, length)) // dropped, reported in decoding loop
+        return;
 
-    receive_semaphore_.post();
+    // flush early if buffer fills up
+    if (buffer.size() > buffer.capacity() / 2)
+        receive_semaphore_.post();
 }
@@ -21,13 +21,15 @@
 
 #include "datasourcelineinfo.h"
 
-#include <boost/array.hpp>
+#include "spscringbuffer.h"
+
 #include <boost/interprocess/sync/interprocess_semaphore.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
-#include <boost/thread/mutex.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <map>
+#include <memory>
 
 /**
  * Decode ASTERIX from network lines.
@@ -46,6 +48,9 @@ public:
     static const unsigned int MAX_UDP_READ_SIZE    = 1024*1024;
     static const unsigned int MAX_ALL_RECEIVE_SIZE = 100*1024*1024;
 
+    size_t numBytesReceived() const { return bytes_received_; }
+    size_t numBytesDropped() const { return bytes_dropped_; } // not stored due to full receive buffers
+
 protected:
     void start_impl() override final;
     void stop_impl() override final;
@@ -58,14 +63,18 @@ private:
     // ds_id -> line str ->(ip, port)
 
     boost::interprocess::interprocess_semaphore receive_semaphore_;
-    std::map<unsigned int, std::unique_ptr<boost::array<char, MAX_ALL_RECEIVE_SIZE>>> receive_buffers_copy_; // line->buf
-    std::map<unsigned int, size_t> receive_copy_buffer_sizes_; // line -> len
 
-    boost::mutex receive_buffers_mutex_;
-    std::map<unsigned int, std::unique_ptr<boost::array<char, MAX_ALL_RECEIVE_SIZE>>> receive_buffers_; // line -> buf
-    std::map<unsigned int, size_t> receive_buffer_sizes_; // line -> len
+    // line -> buf, created before receiving. written by the io context thread, read in place by the decoding loop
+    std::map<unsigned int, std::unique_ptr<SPSCRingBuffer>> receive_buffers_;
+    std::map<unsigned int, size_t> receive_bytes_dropped_; // line -> dropped bytes already reported
+
+    std::atomic<size_t> bytes_received_ {0};
+    std::atomic<size_t> bytes_dropped_ {0};
 
     boost::posix_time::ptime last_receive_decode_time_;
 
+    bool decodeReceivedData();
+    void updateReceiveCounters();
+
     void storeReceivedData (unsigned int line, const char* data, unsigned int length);
 };
@@ -18,6 +18,7 @@
 #include "asterixpcapdecoder.h"
 #include "asteriximporttask.h"
 #include "packetsniffer.h"
+#include "pcapmappedreader.h"
 
 #include <jasterix/jasterix.h>
 
@@ -185,12 +186,6 @@ void ASTERIXPCAPDecoder::processFile(ASTERIXImportFileInfo& file_info)
         }
     }
 
-    PacketSniffer sniffer;
-    bool file_open = sniffer.openPCAP(file_info.filename);
-
-    //this should have been checked and caught beforehand
-    assert(file_open);
-
     auto callback = [this, current_file_line] (std::unique_ptr<nlohmann::json> data, 
                                                size_t num_frames,
                                                size_t num_records, 
@@ -239,6 +234,48 @@ void ASTERIXPCAPDecoder::processFile(ASTERIXImportFileInfo& file_info)
             job()->fileJasterixCallback(std::move(data), current_file_line, num_frames, num_records, numErrors);
     };
 
+    //read memory mapped if possible, the chunk buffer is reused
+    PCAPMappedReader mapped_reader;
+
+    if (mapped_reader.open(file_info.filename))
+    {
+        std::vector<char> chunk;
+        chunk.reserve(FileChunkSize + PCAPMaxPacketSize);
+
+        bool eof = false;
+
+        while (!eof)
+        {
+            chunk.clear();
+
+            if (!mapped_reader.readNext(chunk, FileChunkSize, signatures, eof))
+            {
+                logerr << "ASTERIXPCAPDecoder: processFile: Could not read data chunk from mapped PCAP";
+                logError("Could not read data chunk from PCAP");
+                break;
+            }
+
+            if (chunk.empty())
+                continue;
+
+            loginf << "ASTERIXPCAPDecoder: processFile: processing " << chunk.size() << " byte(s)";
+
+            task().jASTERIX(true)->decodeData(chunk.data(), chunk.size(), callback);
+
+            chunkFinished();
+        }
+
+        return;
+    }
+
+    logwrn << "ASTERIXPCAPDecoder: processFile: could not map file, reading via pcap";
+
+    PacketSniffer sniffer;
+    bool file_open = sniffer.openPCAP(file_info.filename);
+
+    //this should have been checked and caught beforehand
+    assert(file_open);
+
     size_t max_packets = std::numeric_limits<size_t>::max();
     size_t max_bytes   = FileChunkSize;
 
@@ -36,6 +36,8 @@ public:
     boost::optional<std::string> requiredASTERIXFraming() const override { return std::string(""); }
 
 protected:
+    static const size_t PCAPMaxPacketSize = 65536;
+
     void stop_impl() override final;
 
     bool checkFile(ASTERIXImportFileInfo& file_info, std::string& error) const override final;
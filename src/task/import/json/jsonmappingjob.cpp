@@ -22,14 +22,19 @@
 #include "json_tools.h"
 #include "jsonobjectparser.h"
 #include "asterixjsonparser.h"
+#include "jsonmappingplan.h"
 #include "logger.h"
 
+#include "tbbhack.h"
+
 #include <exception>
 
 using namespace std;
 using namespace Utils;
 using namespace nlohmann;
 
+const size_t JSONMappingJob::MinRecordsPerPartition = 500;
+
 JSONMappingJob::JSONMappingJob(std::unique_ptr<nlohmann::json> data,
                                const std::vector<std::string>& data_record_keys,
                                unsigned int line_id,
@@ -94,6 +99,8 @@ void JSONMappingJob::run_impl()
     }
     buffers_ = not_empty_buffers;  // cleaner
 
+    asterix_mapping_plans_.clear();
+
     done_ = true;
     data_ = nullptr;
 
@@ -121,85 +128,177 @@ void JSONMappingJob::parseJSON()
 {
     assert (!asterix_parsers_);
 
+    if (obsolete_)
+    {
+        done_ = true;
+        return;
+    }
+    assert(data_);
+
+    // flat record arrays are split into partitions which are mapped in parallel into separate buffers,
+    // which are then merged in record order
+    if (data_record_keys_.size() == 1 && data_->contains(data_record_keys_.at(0))
+        && data_->at(data_record_keys_.at(0)).is_array())
+    {
+        json& records = data_->at(data_record_keys_.at(0));
+
+        size_t num_records    = records.size();
+        size_t num_partitions = std::max((size_t) 1, num_records / MinRecordsPerPartition);
+
+        logdbg << "JSONMappingJob: parseJSON: mapping " << num_records << " records in "
+               << num_partitions << " partitions";
+
+        std::vector<JSONMappingPartition> partitions(num_partitions);
+
+        tbb::parallel_for(size_t(0), num_partitions, [&](size_t part_cnt)
+        {
+            JSONMappingPartition& partition = partitions[ part_cnt ];
+
+            createJSONBuffers(partition);
+
+            size_t r0 = num_records * part_cnt / num_partitions;
+            size_t r1 = num_records * (part_cnt + 1) / num_partitions;
+
+            for (size_t r = r0; r < r1 && !obsolete_; ++r)
+                mapJSONRecord(records[ r ], partition);
+        });
+
+        for (auto& partition : partitions)
+            mergePartition(partition);
+
+        return;
+    }
+
+    JSONMappingPartition partition;
+
+    createJSONBuffers(partition);
+
+    auto process_lambda = [this, &partition](nlohmann::json& record) {
+        mapJSONRecord(record, partition);
+    };
+
+    logdbg << "JSONMappingJob: parseJSON: applying JSON function";
+
+    JSON::applyFunctionToValues(*data_.get(), data_record_keys_, data_record_keys_.begin(),
+                                process_lambda, false);
+
+    mergePartition(partition);
+}
+
+/**
+ * Creates the buffers of all active parsers and the mapping plans referencing them.
+ */
+void JSONMappingJob::createJSONBuffers(JSONMappingPartition& partition) const
+{
     for (auto& parser_it : *json_parsers_)
     {
         if (!parser_it.second->active())
             continue;
 
-        if (!buffers_.count(parser_it.second->dbContentName()))
-            buffers_[parser_it.second->dbContentName()] = parser_it.second->getNewBuffer();
+        if (!partition.buffers.count(parser_it.second->dbContentName()))
+            partition.buffers[parser_it.second->dbContentName()] = parser_it.second->getNewBuffer();
         else
             parser_it.second->appendVariablesToBuffer(
-                *buffers_.at(parser_it.second->dbContentName()));
+                *partition.buffers.at(parser_it.second->dbContentName()));
     }
 
-    auto process_lambda = [this](nlohmann::json& record) {
-        //loginf << "UGA '" << record.dump(4) << "'";
+    // compile plans after all variables were added, since they reference the buffer columns
+    for (auto& parser_it : *json_parsers_)
+    {
+        if (!parser_it.second->active())
+            continue;
 
-        unsigned int category{0};
-        bool has_cat = record.contains("category");
+        partition.mapping_plans[parser_it.first] =
+            parser_it.second->createMappingPlan(*partition.buffers.at(parser_it.second->dbContentName()));
+    }
+}
 
-        record["line_id"] = line_id_;
+/**
+ * Maps a single json record into the buffers of the given partition.
+ */
+void JSONMappingJob::mapJSONRecord(nlohmann::json& record, JSONMappingPartition& partition) const
+{
+    //loginf << "UGA '" << record.dump(4) << "'";
 
-        if (has_cat)
-            category = record.at("category");
+    unsigned int category{0};
+    bool has_cat = record.contains("category");
 
-        bool parsed{false};
-        bool parsed_any{false};
+    record["line_id"] = line_id_;
 
-        for (auto& map_it : *json_parsers_)
-        {
-            if (!map_it.second->active())
-                continue;
+    if (has_cat)
+        category = record.at("category");
 
-            logdbg << "JSONMappingJob: parseJSON: mapping json: obj " << map_it.second->dbContentName();
-            std::shared_ptr<Buffer>& buffer = buffers_.at(map_it.second->dbContentName());
-            assert(buffer);
-            try
-            {
-                logdbg << "JSONMappingJob: parseJSON: obj " << map_it.second->dbContentName() << " parsing JSON";
+    bool parsed{false};
+    bool parsed_any{false};
 
-                parsed = map_it.second->parseJSON(record, *buffer);
+    for (auto& map_it : *json_parsers_)
+    {
+        if (!map_it.second->active())
+            continue;
 
-                logdbg << "JSONMappingJob: parseJSON: obj " << map_it.second->dbContentName() << " done";
+        logdbg << "JSONMappingJob: mapJSONRecord: mapping json: obj " << map_it.second->dbContentName();
+        assert(partition.buffers.at(map_it.second->dbContentName()));
+        try
+        {
+            logdbg << "JSONMappingJob: mapJSONRecord: obj " << map_it.second->dbContentName() << " parsing JSON";
 
-                parsed_any |= parsed;
-            }
-            catch (exception& e)
-            {
-                logerr << "JSONMappingJob: parseJSON: caught exception '" << e.what() << "' in \n'"
-                       << record.dump(4) << "' parser " << map_it.second->dbContentName();
+            parsed = map_it.second->parseJSON(record, *partition.mapping_plans.at(map_it.first));
 
-                ++num_errors_;
+            logdbg << "JSONMappingJob: mapJSONRecord: obj " << map_it.second->dbContentName() << " done";
 
-                continue;
-            }
+            parsed_any |= parsed;
         }
-
-        if (parsed_any)
+        catch (exception& e)
         {
-            if (has_cat)
-                category_mapped_counts_[category].first += 1;
-            ++num_mapped_;
+            logerr << "JSONMappingJob: mapJSONRecord: caught exception '" << e.what() << "' in \n'"
+                   << record.dump(4) << "' parser " << map_it.second->dbContentName();
+
+            ++partition.num_errors;
+
+            continue;
         }
+    }
+
+    if (parsed_any)
+    {
+        if (has_cat)
+            partition.category_mapped_counts[category].first += 1;
+        ++partition.num_mapped;
+    }
+    else
+    {
+        if (has_cat)
+            partition.category_mapped_counts[category].second += 1;
+        ++partition.num_not_mapped;
+    }
+}
+
+/**
+ * Appends the buffers and counts of the given partition to the job's results.
+ */
+void JSONMappingJob::mergePartition(JSONMappingPartition& partition)
+{
+    partition.mapping_plans.clear(); // reference buffers
+
+    for (auto& buf_it : partition.buffers)
+    {
+        if (!buffers_.count(buf_it.first))
+            buffers_[buf_it.first] = buf_it.second;
         else
-        {
-            if (has_cat)
-                category_mapped_counts_[category].second += 1;
-            ++num_not_mapped_;
-        }
-    };
+            buffers_.at(buf_it.first)->seizeBuffer(*buf_it.second);
+    }
 
-    if (obsolete_)
+    partition.buffers.clear();
+
+    for (auto& cat_it : partition.category_mapped_counts)
     {
-        done_ = true;
-        return;
+        category_mapped_counts_[cat_it.first].first  += cat_it.second.first;
+        category_mapped_counts_[cat_it.first].second += cat_it.second.second;
     }
-    assert(data_);
-    logdbg << "JSONMappingJob: parseJSON: applying JSON function";
 
-    JSON::applyFunctionToValues(*data_.get(), data_record_keys_, data_record_keys_.begin(),
-                                process_lambda, false);
+    num_mapped_     += partition.num_mapped;
+    num_not_mapped_ += partition.num_not_mapped;
+    num_errors_     += partition.num_errors;
 }
 
 void JSONMappingJob::parseASTERIX()
@@ -215,6 +314,10 @@ void JSONMappingJob::parseASTERIX()
                 *buffers_.at(parser_it.second->dbContentName()));
     }
 
+    for (auto& parser_it : *asterix_parsers_)
+        asterix_mapping_plans_[parser_it.first] =
+            parser_it.second->createMappingPlan(*buffers_.at(parser_it.second->dbContentName()));
+
     auto process_lambda = [this](nlohmann::json& record) {
         //loginf << "UGA '" << record.dump(4) << "'";
 
@@ -244,7 +347,7 @@ void JSONMappingJob::parseASTERIX()
         {
             logdbg << "ASTERIXJSONMappingJob: run: obj " << dbcontent_name << " parsing JSON";
 
-            parsed = parser->parseJSON(record, *buffer);
+            parsed = parser->parseJSON(record, *asterix_mapping_plans_.at(category));
 
 //            if (parsed)
 //            {
@@ -27,6 +27,7 @@
 class JSONObjectParser;
 class ASTERIXJSONParser;
 class Buffer;
+class JSONMappingPlan;
 
 class JSONMappingJob : public Job
 {
@@ -72,8 +73,28 @@ private:
 
     std::map<std::string, std::shared_ptr<Buffer>> buffers_;
 
+    std::map<unsigned int, std::unique_ptr<JSONMappingPlan>> asterix_mapping_plans_; // category -> plan
+
+    /// buffers, plans and counts of a range of json records mapped by a single thread
+    struct JSONMappingPartition
+    {
+        std::map<std::string, std::shared_ptr<Buffer>>          buffers;
+        std::map<std::string, std::unique_ptr<JSONMappingPlan>> mapping_plans; // parser name -> plan
+
+        std::map<unsigned int, std::pair<size_t, size_t>> category_mapped_counts;
+        size_t num_mapped {0};
+        size_t num_not_mapped {0};
+        size_t num_errors {0};
+    };
+
+    static const size_t MinRecordsPerPartition;
+
     void parseJSON();
     void parseASTERIX();
+
+    void createJSONBuffers(JSONMappingPartition& partition) const;
+    void mapJSONRecord(nlohmann::json& record, JSONMappingPartition& partition) const;
+    void mergePartition(JSONMappingPartition& partition);
 };
 
 #endif  // JSONMAPPINGJOB_H
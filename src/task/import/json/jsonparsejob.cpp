@@ -21,6 +21,10 @@
 #include "asterixpostprocess.h"
 #include "logger.h"
 
+#include "tbbhack.h"
+
+#include <vector>
+
 using namespace nlohmann;
 using namespace Utils;
 
@@ -134,18 +138,36 @@ void JSONParseJob::run_impl()
 
         json& records = json_objects_->at("data");
 
-        for (auto& str_it : objects_)
+        // objects are parsed in parallel and added in read order
+        size_t num_objects = objects_.size();
+
+        std::vector<json> parsed_objects(num_objects);
+        std::vector<char> parse_ok(num_objects, 0); // char to allow concurrent writes
+
+        tbb::parallel_for(size_t(0), num_objects, [&](size_t cnt)
         {
             try
             {
-                records.push_back(json::parse(str_it));
+                parsed_objects[ cnt ] = json::parse(objects_[ cnt ]);
+                parse_ok[ cnt ] = 1;
             }
             catch (nlohmann::detail::parse_error& e)
             {
-                logwrn << "JSONParseJob: run: parse error " << e.what() << " in '" << str_it << "'";
+                logwrn << "JSONParseJob: run: parse error " << e.what() << " in '" << objects_[ cnt ] << "'";
+            }
+        });
+
+        records.get_ref<json::array_t&>().reserve(num_objects);
+
+        for (size_t cnt = 0; cnt < num_objects; ++cnt)
+        {
+            if (!parse_ok[ cnt ])
+            {
                 ++parse_errors_;
                 continue;
             }
+
+            records.push_back(std::move(parsed_objects[ cnt ]));
             ++objects_parsed_;
         }
     }
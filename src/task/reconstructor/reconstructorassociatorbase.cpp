@@ -8,6 +8,8 @@
 
 #include <QApplication>
 
+#include <algorithm>
+
 #define FIND_UTN_FOR_TARGET_MT
 #define FIND_UTN_FOR_TARGET_REPORT_MT
 
@@ -136,6 +138,9 @@ void ReconstructorAssociatorBase::reset()
     unassoc_rec_nums_.clear();
     assoc_counts_.clear();
 
+    target_index_.clear();
+    target_index_dirty_ = true;
+
     num_merges_ = 0;
 
     time_assoc_trs_ = {};
@@ -157,9 +162,21 @@ void ReconstructorAssociatorBase::associateTargetReports()
 
     bool is_unreliable_primary_only;
 
-    boost::posix_time::ptime last_ts;
+    target_index_dirty_ = true; // targets might have changed since last association
+
+    std::unordered_set<unsigned long> partition_rec_nums; // already associated in mode s partitions
+
+    if (reconstructor().settings().parallel_association_)
+    {
+        associateModeSPartitions(partition_rec_nums);
+
+        if (reconstructor().isCancelled())
+            return;
+    }
+
+    Time::Timestamp last_ts;
 
-    auto five_min = boost::posix_time::seconds(5*60);
+    const int64_t five_min = Time::Timestamp::microseconds(boost::posix_time::seconds(5*60));
     unsigned int ts_cnt=0;
 
     for (auto& ts_it : reconstructor().tr_timestamps_)
@@ -167,18 +184,18 @@ void ReconstructorAssociatorBase::associateTargetReports()
         if (reconstructor().isCancelled())
             return;
 
-        if (last_ts.is_not_a_date_time())
+        if (!last_ts.valid())
         {
             last_ts = ts_it.first;
             loginf << "ReconstructorAssociatorBase: associateTargetReports: start time "
-                   << Time::toString(last_ts) << " ts_cnt " << ts_cnt;
+                   << Time::toString(last_ts.toPTime()) << " ts_cnt " << ts_cnt;
         }
 
         if (ts_it.first - last_ts > five_min)
         {
             last_ts = ts_it.first;
             loginf << "ReconstructorAssociatorBase: associateTargetReports: processed time "
-                   << Time::toString(last_ts) << " ts_cnt " << ts_cnt;
+                   << Time::toString(last_ts.toPTime()) << " ts_cnt " << ts_cnt;
         }
 
         rec_num = ts_it.second;
@@ -201,6 +218,15 @@ void ReconstructorAssociatorBase::associateTargetReports()
             continue;
         }
 
+        if (partition_rec_nums.count(rec_num))
+        {
+            if (do_debug_rec_num)
+                loginf << "DBG tr " << rec_num << " already associated in mode s partition";
+
+            ++ts_cnt;
+            continue;
+        }
+
         if (reconstructor().acc_estimator_->canCorrectPosition(tr))
         {
             if (do_debug_rec_num)
@@ -261,6 +287,130 @@ void ReconstructorAssociatorBase::associateTargetReports()
     loginf << "ReconstructorAssociatorBase: associateTargetReports: done";
 }
 
+/**
+ * Speculative parallel association of the mode s target reports in the current slice.
+ *
+ * Target reports with a mode s address already known at the start of the slice are associated by the
+ * sequential association to the utn stored for the address, so they are partitioned by utn. Partitions
+ * touch disjoint targets and chains, each one is added to its target by a single thread in time order.
+ * Shared lookups, counts and stats are updated afterwards in a merge step in global time order, so the
+ * results do not depend on scheduling. All other target reports are left to the sequential association.
+ */
+void ReconstructorAssociatorBase::associateModeSPartitions(std::unordered_set<unsigned long>& associated_rec_nums)
+{
+    struct Partition
+    {
+        unsigned int utn;
+        std::vector<dbContent::targetReport::ReconstructorInfo*> trs; // in time order
+        std::vector<reconstruction::UpdateStats> stats;
+    };
+
+    auto& targets_container = reconstructor().targets_container_;
+
+    std::vector<Partition> partitions;
+    std::map<unsigned int, size_t> partition_indexes; // utn -> index in partitions
+    std::vector<std::pair<dbContent::targetReport::ReconstructorInfo*, unsigned int>> associations; // tr, utn
+
+    for (auto& ts_it : reconstructor().tr_timestamps_)
+    {
+        dbContent::targetReport::ReconstructorInfo& tr = reconstructor().target_reports_.at(ts_it.second);
+
+        if (!tr.in_current_slice_ || !tr.acad_)
+            continue;
+
+        // unreliable primary only, delayed until retry
+        if (tr.dbcont_id_ != 62 && tr.dbcont_id_  != 255 && tr.isPrimaryOnlyDetection())
+            continue;
+
+        auto acad_it = targets_container.acad_2_utn_.find(*tr.acad_);
+
+        if (acad_it == targets_container.acad_2_utn_.end()) // new target might be created, done sequentially
+            continue;
+
+        unsigned int utn = acad_it->second;
+
+        auto index_it = partition_indexes.find(utn);
+
+        if (index_it == partition_indexes.end())
+        {
+            index_it = partition_indexes.emplace(utn, partitions.size()).first;
+
+            partitions.emplace_back();
+            partitions.back().utn = utn;
+        }
+
+        partitions.at(index_it->second).trs.push_back(&tr);
+        associations.emplace_back(&tr, utn);
+    }
+
+    loginf << "ReconstructorAssociatorBase: associateModeSPartitions: num partitions " << partitions.size()
+           << " num target reports " << associations.size();
+
+    if (!partitions.size())
+        return;
+
+    // look up serially, chain(utn) might insert into the map
+    for (auto& partition : partitions)
+    {
+        assert (targets_container.targets_.count(partition.utn));
+        reconstructor().chain(partition.utn);
+
+        partition.stats.resize(partition.trs.size());
+    }
+
+    unsigned int num_partitions = partitions.size();
+
+    tbb::parallel_for(uint(0), num_partitions, [&](unsigned int cnt)
+    {
+        Partition& partition = partitions[cnt];
+        dbContent::ReconstructorTarget& target = targets_container.targets_.at(partition.utn);
+
+        for (size_t tr_cnt = 0; tr_cnt < partition.trs.size(); ++tr_cnt)
+        {
+            dbContent::targetReport::ReconstructorInfo& tr = *partition.trs[tr_cnt];
+
+            if (reconstructor().acc_estimator_->canCorrectPosition(tr))
+                reconstructor().acc_estimator_->correctPosition(tr);
+
+            reconstructor().acc_estimator_->validate(tr);
+
+            tr.is_pos_outlier_ = false;
+
+            if (!tr.doNotUsePosition())
+                reconstructor().acc_estimator_->doOutlierDetection(tr, partition.utn);
+
+            target.addTargetReport(tr.record_num_, partition.stats[tr_cnt]);
+        }
+    });
+
+    // merge
+    for (const auto& partition : partitions)
+        for (const auto& s : partition.stats)
+            dbContent::ReconstructorTarget::addUpdateToGlobalStats(s);
+
+    for (auto& assoc_it : associations)
+    {
+        dbContent::targetReport::ReconstructorInfo& tr = *assoc_it.first;
+        unsigned int utn = assoc_it.second;
+
+        if (reconstructor().task().debugSettings().debug_association_
+            && (reconstructor().task().debugSettings().debugRecNum(tr.record_num_)
+                || reconstructor().task().debugSettings().debugUTN(utn)))
+            loginf << "DBG associated (mode s partition) tr " << tr.record_num_ << " to UTN " << utn;
+
+        if (!target_index_dirty_ && tr.position())
+            target_index_.add(utn, tr.timestamp_, tr.position()->latitude_, tr.position()->longitude_);
+
+        targets_container.addToLookup(utn, tr);
+
+        assoc_counts_[tr.ds_id_][Number::recNumGetDBContId(tr.record_num_)].first++;
+
+        postAssociate (tr, utn);
+
+        associated_rec_nums.insert(tr.record_num_);
+    }
+}
+
 void ReconstructorAssociatorBase::associateTargetReports(std::set<unsigned int> dbcont_ids)
 {
     loginf << "ReconstructorAssociatorBase: associateTargetReports: dbcont_ids " << String::compress(dbcont_ids, ',');
@@ -272,6 +422,8 @@ void ReconstructorAssociatorBase::associateTargetReports(std::set<unsigned int>
 
     reconstructor().targets_container_.checkACADLookup();
 
+    target_index_dirty_ = true; // targets might have changed since last association
+
     for (auto& ts_it : reconstructor().tr_timestamps_)
     {
         if (reconstructor().isCancelled())
@@ -325,6 +477,9 @@ void ReconstructorAssociatorBase::selfAssociateNewUTNs()
     std::multimap<float, std::pair<unsigned int, unsigned int>> scored_utn_pairs;
     set<unsigned int> utns_joined; // already joined in current run, do only once to be save
     set<unsigned int> utns_to_remove;
+    std::vector<unsigned int> utns_to_reestimate; // merged targets, if chains reestimated in parallel
+
+    bool parallel_reestimation = reconstructor().settings().parallel_chain_reestimation_;
 
     float score;
     std::pair<unsigned int, unsigned int> utn_pair;
@@ -335,6 +490,7 @@ RESTART_SELF_ASSOC:
     scored_utn_pairs.clear();
     utns_joined.clear();
     utns_to_remove.clear();
+    utns_to_reestimate.clear();
 
     if (reconstructor().isCancelled())
         return;
@@ -402,7 +558,10 @@ RESTART_SELF_ASSOC:
                        << String::doubleToStringPrecision(score, 2);
 
                 // move target reports
-                target.addTargetReports(other_target);
+                target.addTargetReports(other_target, true, !parallel_reestimation);
+
+                if (parallel_reestimation)
+                    utns_to_reestimate.push_back(utn);
 
                 // schedule remove from targets
                 utns_to_remove.insert(other_utn);
@@ -413,6 +572,8 @@ RESTART_SELF_ASSOC:
 
                 reconstructor().targets_container_.replaceInLookup(other_utn, utn);
 
+                target_index_dirty_ = true;
+
                 ++num_merges_;
             }
         }
@@ -421,6 +582,13 @@ RESTART_SELF_ASSOC:
         scored_utn_pairs.erase(range.first, range.second);
     }
 
+    // merged targets are disjoint, so their chains can be reestimated independently
+    if (utns_to_reestimate.size())
+    {
+        std::sort(utns_to_reestimate.begin(), utns_to_reestimate.end());
+        reconstructor().reestimateChains(utns_to_reestimate);
+    }
+
     // remove scheduled from targets
     if (utns_to_remove.size())
     {
@@ -458,6 +626,7 @@ void ReconstructorAssociatorBase::retryAssociateTargetReports()
 
     unsigned int assocated_cnt{0};
 
+    target_index_dirty_ = true; // targets might have changed since last association
 
     for (auto rec_num_it = unassoc_rec_nums_.rbegin(); rec_num_it != unassoc_rec_nums_.rend();)
     {
@@ -559,6 +728,9 @@ void ReconstructorAssociatorBase::associate(
 
     reconstructor().targets_container_.targets_.at(utn).addTargetReport(tr.record_num_);
 
+    if (!target_index_dirty_ && tr.position())
+        target_index_.add(utn, tr.timestamp_, tr.position()->latitude_, tr.position()->longitude_);
+
     // if (do_debug)
     //     loginf << "DBG add to lookups";
 
@@ -727,8 +899,14 @@ START_TR_ASSOC:
 int ReconstructorAssociatorBase::findUTNByModeACPos (
     const dbContent::targetReport::ReconstructorInfo& tr)
 {
-    unsigned int num_targets = reconstructor().targets_container_.targets_.size();
-    assert (reconstructor().targets_container_.utn_vec_.size() == num_targets);
+    assert (reconstructor().targets_container_.utn_vec_.size() == reconstructor().targets_container_.targets_.size());
+
+    // check only candidates from index if possible, same order as utn_vec_ (ascending)
+    vector<unsigned int> candidate_utns;
+    bool use_candidates = findCandidateUTNs(tr, candidate_utns);
+
+    const vector<unsigned int>& utns = use_candidates ? candidate_utns : reconstructor().targets_container_.utn_vec_;
+    unsigned int num_targets = utns.size();
 
     vector<tuple<bool, unsigned int, double>> results;
     vector<reconstruction::PredictionStats> prediction_stats;
@@ -751,7 +929,7 @@ int ReconstructorAssociatorBase::findUTNByModeACPos (
     for (unsigned int target_cnt = 0; target_cnt < num_targets; ++target_cnt)
 #endif
                       {
-                          unsigned int other_utn = reconstructor().targets_container_.utn_vec_.at(target_cnt);
+                          unsigned int other_utn = utns.at(target_cnt);
                           //bool do_other_debug = false; //debug_utns.count(other_utn);
 
                           //do_debug = tr.dbcont_id_ == 10 && other_utn == 7;
@@ -941,6 +1119,65 @@ int ReconstructorAssociatorBase::findUTNByModeACPos (
     return -1;
 }
 
+/**
+ * Only targets with a position within the max association distance can be accepted by
+ * calculatePositionOffsetScore, all other checks are still done for the candidates.
+ */
+bool ReconstructorAssociatorBase::findCandidateUTNs (
+    const dbContent::targetReport::ReconstructorInfo& tr, std::vector<unsigned int>& utns)
+{
+    if (!reconstructor().settings().use_association_index_)
+        return false;
+
+    boost::optional<double> max_distance = maxAssociationDistance();
+
+    if (!max_distance || *max_distance <= 0)
+        return false;
+
+    if (!tr.position_) // no offset can be computed
+    {
+        utns.clear();
+        return true;
+    }
+
+    if (target_index_dirty_ || target_index_.maxDistance() != *max_distance
+        || target_index_.maxTimeDiff() != max_time_diff_)
+        rebuildTargetIndex(*max_distance);
+
+    if (!target_index_.query(utns, tr.timestamp_, tr.position_->latitude_, tr.position_->longitude_))
+        return false;
+
+    // remove targets which do not exist anymore
+    const auto& targets = reconstructor().targets_container_.targets_;
+
+    utns.erase(std::remove_if(utns.begin(), utns.end(),
+                              [ & ] (unsigned int utn) { return !targets.count(utn); }), utns.end());
+
+    return true;
+}
+
+void ReconstructorAssociatorBase::rebuildTargetIndex (double max_distance_m)
+{
+    logdbg << "ReconstructorAssociatorBase: rebuildTargetIndex: max_distance " << max_distance_m;
+
+    target_index_.configure(max_distance_m, max_time_diff_);
+
+    for (auto& tgt_it : reconstructor().targets_container_.targets_)
+    {
+        for (auto& ts_it : tgt_it.second.tr_timestamps_)
+        {
+            const dbContent::targetReport::ReconstructorInfo* tr = reconstructor().getInfo(ts_it.second);
+
+            if (tr && tr->position())
+                target_index_.add(tgt_it.first, tr->timestamp_, tr->position()->latitude_, tr->position()->longitude_);
+        }
+    }
+
+    target_index_dirty_ = false;
+
+    logdbg << "ReconstructorAssociatorBase: rebuildTargetIndex: done, cells " << target_index_.numCells();
+}
+
 std::pair<float, std::pair<unsigned int, unsigned int>> ReconstructorAssociatorBase::findUTNsForTarget (
     unsigned int utn)
 {
@@ -3,6 +3,9 @@
 #include "targetreportdefs.h"
 #include "reconstructortarget.h"
 #include "reconstructorbase.h"
+#include "targetpositionindex.h"
+
+#include <unordered_set>
 
 // used settings from ReconstructorBaseSettings
 // max_time_diff_
@@ -12,6 +15,7 @@
 // target_max_positions_dubious_unknown_rate_
 // target_min_updates_
 // target_prob_min_time_overlap_
+// parallel_association_
 
 class ReconstructorAssociatorBase
 {
@@ -65,6 +69,9 @@ class ReconstructorAssociatorBase
     virtual bool isTargetAccuracyAcceptable(
         double tgt_est_std_dev, unsigned int utn, const dbContent::targetReport::ReconstructorInfo& tr, bool do_debug) = 0;
 
+    // distance beyond which calculatePositionOffsetScore never accepts, empty if not bounded
+    virtual boost::optional<double> maxAssociationDistance() { return {}; }
+
     const std::vector<unsigned long>& unassociatedRecNums() const;
 
 protected:
@@ -81,8 +88,13 @@ protected:
     boost::posix_time::time_duration time_assoc_new_utns_;
     boost::posix_time::time_duration time_retry_assoc_trs_;
 
+    TargetPositionIndex target_index_;
+    bool target_index_dirty_ {true}; // set if targets were changed other than by associate
+
     void associateTargetReports();
     void associateTargetReports(std::set<unsigned int> dbcont_ids);
+    // associates mode s target reports of known targets in parallel, returns associated record numbers
+    void associateModeSPartitions(std::unordered_set<unsigned long>& associated_rec_nums);
 
     void selfAssociateNewUTNs();
     void retryAssociateTargetReports();
@@ -96,6 +108,10 @@ protected:
             // tries to find existing utn for target report, based on mode a/c and position, -1 if failed
     int findUTNByModeACPos (const dbContent::targetReport::ReconstructorInfo& tr);
 
+    // collects sorted utns of targets which could be within the max association distance, false if not possible
+    bool findCandidateUTNs (const dbContent::targetReport::ReconstructorInfo& tr, std::vector<unsigned int>& utns);
+    void rebuildTargetIndex (double max_distance_m);
+
     // score -> utn, other_utn
     std::pair<float, std::pair<unsigned int, unsigned int>> findUTNsForTarget (
         unsigned int utn); //  const std::set<unsigned int>& utns_to_ignore
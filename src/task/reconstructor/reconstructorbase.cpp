@@ -482,6 +482,12 @@ ReconstructorBase::ReconstructorBase(const std::string& class_id,
                       base_settings_.do_track_number_disassociate_using_distance_);
     registerParameter("tn_disassoc_distance_factor", &base_settings_.tn_disassoc_distance_factor_,
                       base_settings_.tn_disassoc_distance_factor_);
+    registerParameter("use_association_index", &base_settings_.use_association_index_,
+                      base_settings_.use_association_index_);
+    registerParameter("parallel_chain_reestimation", &base_settings_.parallel_chain_reestimation_,
+                      base_settings_.parallel_chain_reestimation_);
+    registerParameter("parallel_association", &base_settings_.parallel_association_,
+                      base_settings_.parallel_association_);
 
 
     registerParameter("target_prob_min_time_overlap", &base_settings_.target_prob_min_time_overlap_,
@@ -844,6 +850,9 @@ void ReconstructorBase::processSlice()
         accessor_->removeContentBeforeTimestamp(currentSlice().remove_before_time_);
     }
 
+    if (!currentSlice().target_reports_prepared_)
+        prepareSlice(currentSlice(), targetReportInfoContext());
+
     loginf << "ReconstructorBase: processSlice: adding, size " << currentSlice().data_.size();
 
     accessor_->add(currentSlice().data_);
@@ -883,41 +892,31 @@ void ReconstructorBase::clearOldTargetReports()
     tr_timestamps_.clear();
     tr_ds_.clear();
 
-    for (auto tr_it = target_reports_.begin(); tr_it != target_reports_.end() /* not hoisted */; /* no increment */)
-    {
-        if (tr_it->second.timestamp_ < currentSlice().remove_before_time_)
-        {
-            //loginf << "ReconstructorBase: clearOldTargetReports: removing " << Time::toString(ts_it->second.timestamp_);
-            tr_it = target_reports_.erase(tr_it);
-        }
-        else
-        {
-            //loginf << "ReconstructorBase: clearOldTargetReports: keeping " << Time::toString(ts_it->second.timestamp_);
-
-            tr_it->second.in_current_slice_ = false;
-            tr_it->second.buffer_index_ = std::numeric_limits<unsigned int>::max(); // set to impossible value
+    // remove old ones in bulk
+    target_reports_.removeIf([ & ] (const dbContent::targetReport::ReconstructorInfo& tr)
+                             { return tr.timestamp_ < currentSlice().remove_before_time_; });
 
-            // add to lookup structures
-            tr_timestamps_.insert({tr_it->second.timestamp_, tr_it->second.record_num_});
+    for (auto& tr : target_reports_)
+    {
+        tr.in_current_slice_ = false;
+        tr.buffer_index_ = std::numeric_limits<unsigned int>::max(); // set to impossible value
 
-            tr_ds_[Number::recNumGetDBContId(tr_it->second.record_num_)]
-                  [tr_it->second.ds_id_][tr_it->second.line_id_].push_back(
-                          tr_it->second.record_num_);
+        // add to lookup structures
+        tr_timestamps_.insert({Time::Timestamp(tr.timestamp_), tr.record_num_});
 
-            ++tr_it;
-        }
+        tr_ds_[Number::recNumGetDBContId(tr.record_num_)][tr.ds_id_][tr.line_id_].push_back(tr.record_num_);
     }
 
 #if DO_RECONSTRUCTOR_PEDANTIC_CHECKING
 
-    for (auto& tr_it : target_reports_)
+    for (auto& tr : target_reports_)
     {
-        assert (tr_it.second.timestamp_ >= currentSlice().remove_before_time_);
-        assert (!tr_it.second.in_current_slice_);
+        assert (tr.timestamp_ >= currentSlice().remove_before_time_);
+        assert (!tr.in_current_slice_);
     }
 
     for (auto& ts_it : tr_timestamps_)
-        assert (ts_it.first >= currentSlice().remove_before_time_);
+        assert (ts_it.first >= Time::Timestamp(currentSlice().remove_before_time_));
 
 #endif
 
@@ -946,6 +945,130 @@ void ReconstructorBase::clearOldTargetReports()
     }
 }
 
+/**
+ * Collects the dbcontent and data source info needed by createTargetReportInfo(). Accesses the
+ * managers and the task, so it has to be called in the main thread.
+ */
+ReconstructorBase::TargetReportInfoContext ReconstructorBase::targetReportInfoContext() const
+{
+    TargetReportInfoContext context;
+
+    DBContentManager& dbcont_man = COMPASS::instance().dbContentManager();
+
+    for (auto& dbcont_it : dbcont_man)
+        context.dbcont_ids[ dbcont_it.first ] = dbcont_it.second->id();
+
+    context.unused_ds_ids = task_.unusedDSIDs();
+    context.unused_lines  = task_.unusedDSIDLines();
+
+    auto& ds_man = COMPASS::instance().dataSourceManager();
+
+    context.ground_only_ds_ids = ds_man.groundOnlyDBDataSources();
+
+    for (const auto& ds_it : ds_man.dbDataSources())
+    {
+        if (ds_it->sac() == ReconstructorBaseSettings::REC_DS_SAC
+            && ds_it->sic() == ReconstructorBaseSettings::REC_DS_SIC)
+            context.calc_ref_ds_ids.insert(ds_it->id());
+    }
+
+    return context;
+}
+
+/**
+ * Creates the infos of all target reports with position in the slice data, so that this
+ * does not have to be done in processing. Only the slice is modified and all other info is
+ * taken from the passed context, so it can run for the next slice while the current one is processed.
+ */
+void ReconstructorBase::prepareSlice(DataSlice& slice, const TargetReportInfoContext& context) const
+{
+    logdbg << "ReconstructorBase: prepareSlice: slice_begin " << Time::toString(slice.slice_begin_);
+
+    assert (!slice.target_reports_prepared_);
+
+    dbContent::DBContentAccessor slice_accessor; // shares buffers with slice
+    slice_accessor.add(slice.data_);
+
+    unsigned int num_prepared = 0;
+
+    for (auto& buf_it : slice_accessor)
+    {
+        assert (context.dbcont_ids.count(buf_it.first));
+        unsigned int dbcont_id = context.dbcont_ids.at(buf_it.first);
+
+        dbContent::TargetReportAccessor tgt_acc = slice_accessor.targetReportAccessor(buf_it.first);
+
+        DataSlice::PreparedTargetReports& prepared = slice.prepared_target_reports_[dbcont_id];
+
+        prepared.buffer_size_ = tgt_acc.size();
+        prepared.infos_.reserve(prepared.buffer_size_);
+
+        for (unsigned int cnt=0; cnt < prepared.buffer_size_; cnt++)
+        {
+            if (!tgt_acc.position(cnt))
+                continue;
+
+            prepared.infos_.emplace_back();
+
+            createTargetReportInfo(tgt_acc, cnt, dbcont_id, context, prepared.infos_.back());
+        }
+
+        num_prepared += prepared.infos_.size();
+    }
+
+    slice.target_reports_prepared_ = true;
+
+    logdbg << "ReconstructorBase: prepareSlice: done with " << num_prepared << " target reports";
+}
+
+void ReconstructorBase::createTargetReportInfo(const dbContent::TargetReportAccessor& tgt_acc, unsigned int index,
+                                               unsigned int dbcont_id, const TargetReportInfoContext& context,
+                                               dbContent::targetReport::ReconstructorInfo& info) const
+{
+    // base info
+    info.buffer_index_ = index;
+    info.record_num_ = tgt_acc.recordNumber(index);
+    info.dbcont_id_ = dbcont_id;
+    info.ds_id_ = tgt_acc.dsID(index);
+    info.line_id_ = tgt_acc.lineID(index);
+    info.timestamp_ = tgt_acc.timestamp(index);
+
+    // reconstructor info
+    info.in_current_slice_ = true;
+
+    info.is_calculated_reference_ = context.calc_ref_ds_ids.count(info.ds_id_);
+
+    info.acad_ = tgt_acc.acad(index);
+    info.acid_ = tgt_acc.acid(index);
+
+    info.mode_a_code_ = tgt_acc.modeACode(index);
+
+    info.track_number_ = tgt_acc.trackNumber(index);
+    info.track_begin_ = tgt_acc.trackBegin(index);
+    info.track_end_ = tgt_acc.trackEnd(index);
+
+    info.position_ = tgt_acc.position(index);
+    info.position_accuracy_ = tgt_acc.positionAccuracy(index);
+
+
+    info.unsused_ds_pos_ =
+        !info.position().has_value()
+            || (context.unused_ds_ids.count(info.ds_id_)
+            || (context.unused_lines.count(info.ds_id_) && context.unused_lines.at(info.ds_id_).count(info.line_id_)));
+
+    info.barometric_altitude_ = tgt_acc.barometricAltitude(index);
+
+    info.velocity_ = tgt_acc.velocity(index);
+    info.velocity_accuracy_ = tgt_acc.velocityAccuracy(index);
+
+    info.track_angle_ = tgt_acc.trackAngle(index);
+    info.ground_bit_ = tgt_acc.groundBit(index);
+    info.data_source_is_ground_only = context.ground_only_ds_ids.count(info.ds_id_);
+
+    info.mops_ = tgt_acc.mopsVersion(index);
+    info.ecat_ = tgt_acc.ecat(index);
+}
+
 void ReconstructorBase::createTargetReports()
 {
     loginf << "ReconstructorBase: createTargetReports: current_slice_begin "
@@ -964,12 +1087,29 @@ void ReconstructorBase::createTargetReports()
 
     //unsigned int calc_ref_ds_id = Number::dsIdFrom(ds_sac_, ds_sic_);
 
-    std::set<unsigned int> unused_ds_ids = task_.unusedDSIDs();
-    std::map<unsigned int, std::set<unsigned int>> unused_lines = task_.unusedDSIDLines();
+    TargetReportInfoContext context = targetReportInfoContext();
 
-    auto& ds_man = COMPASS::instance().dataSourceManager();
+    assert (currentSlice().target_reports_prepared_);
+
+    auto insert_info = [&] (dbContent::targetReport::ReconstructorInfo& new_info)
+    {
+        record_num = new_info.record_num_;
+        ts = new_info.timestamp_;
+        unsigned int ds_id = new_info.ds_id_;
+        unsigned int line_id = new_info.line_id_;
+        unsigned int dbcont_id = new_info.dbcont_id_;
+
+        // insert info
+        target_reports_.add(std::move(new_info));
 
-    std::set<unsigned int> ground_only_ds_ids = ds_man.groundOnlyDBDataSources();
+        // insert into lookups
+        tr_timestamps_.insert({Time::Timestamp(ts), record_num});
+        // dbcontent id -> ds_id -> ts ->  record_num
+
+        tr_ds_[dbcont_id][ds_id][line_id].push_back(record_num);
+
+        ++num_new_target_reports_in_slice_;
+    };
 
     for (auto& buf_it : *accessor_)
     {
@@ -981,7 +1121,17 @@ void ReconstructorBase::createTargetReports()
         dbContent::TargetReportAccessor& tgt_acc = accessors_.at(dbcont_id);
         unsigned int buffer_size = tgt_acc.size();
 
-        for (unsigned int cnt=0; cnt < buffer_size; cnt++)
+        // data of the current slice was appended to the remaining buffer data
+        auto prepared_it = currentSlice().prepared_target_reports_.find(dbcont_id);
+        unsigned int slice_begin_index = buffer_size;
+
+        if (prepared_it != currentSlice().prepared_target_reports_.end())
+        {
+            assert (prepared_it->second.buffer_size_ <= buffer_size);
+            slice_begin_index = buffer_size - prepared_it->second.buffer_size_;
+        }
+
+        for (unsigned int cnt=0; cnt < slice_begin_index; cnt++)
         {
             record_num = tgt_acc.recordNumber(cnt);
 
@@ -992,11 +1142,12 @@ void ReconstructorBase::createTargetReports()
             if (!tgt_acc.position(cnt))
                 continue;
 
-            if (target_reports_.count(record_num)) // already exist, update buffer_index_
+            auto existing_info = target_reports_.find(record_num);
+
+            if (existing_info) // already exist, update buffer_index_
             {
 #if DO_RECONSTRUCTOR_PEDANTIC_CHECKING
-                //assert (target_reports_.count(record_num));
-                assert (!target_reports_.at(record_num).in_current_slice_);
+                assert (!existing_info->in_current_slice_);
 
                 if (ts < currentSlice().remove_before_time_)
                 {
@@ -1009,84 +1160,52 @@ void ReconstructorBase::createTargetReports()
 
                 assert (ts >= currentSlice().remove_before_time_);
 
-                assert (target_reports_.at(record_num).record_num_ == record_num); // be sure
-                assert (target_reports_.at(record_num).timestamp_ == ts); // be very sure
+                assert (existing_info->record_num_ == record_num); // be sure
+                assert (existing_info->timestamp_ == ts); // be very sure
 #endif
 
-                target_reports_.at(record_num).buffer_index_ = cnt;
+                existing_info->buffer_index_ = cnt;
             }
             else // not yet, insert
             {
-                // base info
-                info.buffer_index_ = cnt;
-                info.record_num_ = record_num;
-                info.dbcont_id_ = dbcont_id;
-                info.ds_id_ = tgt_acc.dsID(cnt);
-                info.line_id_ = tgt_acc.lineID(cnt);
-                info.timestamp_ = ts;
-
-                // reconstructor info
-                info.in_current_slice_ = true;
-
-                info.is_calculated_reference_ =
-                    ds_man.hasDBDataSource(info.ds_id_)
-                    && ds_man.dbDataSource(info.ds_id_).sac() == ReconstructorBaseSettings::REC_DS_SAC
-                    && ds_man.dbDataSource(info.ds_id_).sic() == ReconstructorBaseSettings::REC_DS_SIC;
-
-                info.acad_ = tgt_acc.acad(cnt);
-                info.acid_ = tgt_acc.acid(cnt);
-
-                info.mode_a_code_ = tgt_acc.modeACode(cnt);
-
-                info.track_number_ = tgt_acc.trackNumber(cnt);
-                info.track_begin_ = tgt_acc.trackBegin(cnt);
-                info.track_end_ = tgt_acc.trackEnd(cnt);
-
-                info.position_ = tgt_acc.position(cnt);
-                info.position_accuracy_ = tgt_acc.positionAccuracy(cnt);
-
-
-                info.unsused_ds_pos_ =
-                    !info.position().has_value()
-                        || (unused_ds_ids.count(info.ds_id_)
-                        || (unused_lines.count(info.ds_id_) && unused_lines.at(info.ds_id_).count(info.line_id_)));
-
-                info.barometric_altitude_ = tgt_acc.barometricAltitude(cnt);
-
-                info.velocity_ = tgt_acc.velocity(cnt);
-                info.velocity_accuracy_ = tgt_acc.velocityAccuracy(cnt);
-
-                info.track_angle_ = tgt_acc.trackAngle(cnt);
-                info.ground_bit_ = tgt_acc.groundBit(cnt);
-                info.data_source_is_ground_only = ground_only_ds_ids.count(info.ds_id_);
+                createTargetReportInfo(tgt_acc, cnt, dbcont_id, context, info);
+                insert_info(info);
+            }
+        }
 
-                info.mops_ = tgt_acc.mopsVersion(cnt);
-                info.ecat_ = tgt_acc.ecat(cnt);
+        if (prepared_it == currentSlice().prepared_target_reports_.end())
+            continue;
 
-                // insert info
-                target_reports_[record_num] = info;
+        for (auto& prepared_info : prepared_it->second.infos_)
+        {
+            prepared_info.buffer_index_ += slice_begin_index;
 
-                // insert into lookups
-                tr_timestamps_.insert({ts, record_num});
-                // dbcontent id -> ds_id -> ts ->  record_num
+#if DO_RECONSTRUCTOR_PEDANTIC_CHECKING
+            assert (prepared_info.buffer_index_ < buffer_size);
+            assert (tgt_acc.recordNumber(prepared_info.buffer_index_) == prepared_info.record_num_);
+#endif
 
-                tr_ds_[dbcont_id][info.ds_id_][info.line_id_].push_back(record_num);
+            auto existing_info = target_reports_.find(prepared_info.record_num_);
 
-                ++num_new_target_reports_in_slice_;
-            }
+            if (existing_info) // already exist, update buffer_index_
+                existing_info->buffer_index_ = prepared_info.buffer_index_;
+            else
+                insert_info(prepared_info);
         }
     }
 
+    currentSlice().prepared_target_reports_.clear();
+
 #if DO_RECONSTRUCTOR_PEDANTIC_CHECKING
-    for (auto& tr_it : target_reports_)
+    for (auto& tr : target_reports_)
     {
-        if (tr_it.second.buffer_index_ >= accessor(tr_it.second).size())
-            logerr << "ReconstructorBase: createTargetReports: tr " << tr_it.second.asStr()
-                   << " buffer index " << tr_it.second.buffer_index_
-                   << " accessor size " << accessor(tr_it.second).size() << " is maxint "
-                   << (tr_it.second.buffer_index_ == std::numeric_limits<unsigned int>::max());
+        if (tr.buffer_index_ >= accessor(tr).size())
+            logerr << "ReconstructorBase: createTargetReports: tr " << tr.asStr()
+                   << " buffer index " << tr.buffer_index_
+                   << " accessor size " << accessor(tr).size() << " is maxint "
+                   << (tr.buffer_index_ == std::numeric_limits<unsigned int>::max());
 
-        assert (tr_it.second.buffer_index_ < accessor(tr_it.second).size()); // fails
+        assert (tr.buffer_index_ < accessor(tr).size()); // fails
     }
 #endif
 
@@ -1688,19 +1807,15 @@ void ReconstructorBase::createMeasurement(reconstruction::Measurement& mm,
                                           unsigned long rec_num,
                                           const dbContent::ReconstructorTarget* target)
 {
-    auto it = target_reports_.find(rec_num);
-    assert(it != target_reports_.end());
+    auto tr = target_reports_.find(rec_num);
+    assert(tr);
 
-    createMeasurement(mm, it->second, target);
+    createMeasurement(mm, *tr, target);
 }
 
 const dbContent::targetReport::ReconstructorInfo* ReconstructorBase::getInfo(unsigned long rec_num) const
 {
-    auto it = target_reports_.find(rec_num);
-    if (it == target_reports_.end())
-        return nullptr;
-
-    return &it->second;
+    return target_reports_.find(rec_num);
 }
 
 reconstruction::KalmanChainPredictors& ReconstructorBase::chainPredictors()
@@ -1720,6 +1835,46 @@ std::unique_ptr<reconstruction::KalmanChain>& ReconstructorBase::chain(unsigned
     return chains_[utn];
 }
 
+/**
+ * Reestimates the chains of the given utns in parallel. Chains of different utns do not share
+ * any estimator state, so each chain is reestimated by a single thread using its own tracker.
+ * Update stats are collected per chain and added to the global stats in the given utn order,
+ * so the results do not depend on scheduling.
+ * Only called for the targets merged in one self-association pass. Chains updated by associating
+ * single target reports are reestimated on insert, since the following associations read them.
+ */
+void ReconstructorBase::reestimateChains(const std::vector<unsigned int>& utns)
+{
+    std::vector<reconstruction::KalmanChain*> chains;
+    chains.reserve(utns.size());
+
+    // look up serially, chain(utn) might insert into the map
+    for (auto utn : utns)
+    {
+        auto it = chains_.find(utn);
+
+        if (it != chains_.end() && it->second && it->second->needsReestimate())
+            chains.push_back(it->second.get());
+    }
+
+    if (!chains.size())
+        return;
+
+    std::vector<reconstruction::UpdateStats> stats (chains.size());
+
+    unsigned int num_chains = chains.size();
+
+    tbb::parallel_for(uint(0), num_chains, [&](unsigned int cnt)
+    {
+        chains[cnt]->reestimate(&stats[cnt]);
+    });
+
+    for (const auto& s : stats)
+        dbContent::ReconstructorTarget::addUpdateToGlobalStats(s);
+
+    logdbg << "ReconstructorBase: reestimateChains: reestimated " << num_chains << " chains";
+}
+
 void ReconstructorBase::informConfigChanged()
 {
     emit configChanged();
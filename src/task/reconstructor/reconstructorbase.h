@@ -22,8 +22,10 @@
 #include "configurable.h"
 #include "targetreportdefs.h"
 #include "reconstructortarget.h"
+#include "reconstructorinfostore.h"
 #include "referencecalculator.h"
 #include "kalman_chain.h"
+#include "timestamp.h"
 
 #include "boost/date_time/posix_time/posix_time.hpp"
 
@@ -94,6 +96,13 @@ class ReconstructorBaseSettings
     bool do_track_number_disassociate_using_distance_ {false};
     // if do tn disassc, factor for "normal" assoc threshold to calc threshold
     float tn_disassoc_distance_factor_ {3};
+    // use spatial-temporal index to find mode a/c/pos association candidates
+    bool use_association_index_ {true};
+    // reestimate chains of targets merged in self-association in a parallel stage after merging,
+    // chains updated by associating single target reports are still reestimated on insert
+    bool parallel_chain_reestimation_ {true};
+    // associate mode s target reports of known targets in parallel per-target partitions
+    bool parallel_association_ {false};
 
     // compare targets related
     double target_prob_min_time_overlap_ {0.1};
@@ -158,6 +167,15 @@ public:
         std::map<std::string, std::shared_ptr<Buffer>> data_;
         bool loading_done_ {false}; // set if data_ is set correctly and can be processed
 
+        struct PreparedTargetReports
+        {
+            unsigned int buffer_size_ {0}; // size of data_ buffer
+            std::vector<dbContent::targetReport::ReconstructorInfo> infos_; // buffer index in data_ buffer
+        };
+
+        std::map<unsigned int, PreparedTargetReports> prepared_target_reports_; // dbcont id -> infos
+        bool target_reports_prepared_ {false}; // set if infos were created from data_, before processing
+
         std::map<std::string, std::shared_ptr<Buffer>> assoc_data_;
         std::map<std::string, std::shared_ptr<Buffer>> reftraj_data_;
 
@@ -232,6 +250,18 @@ public:
 
     int numSlices() const;
 
+    /// dbcontent and data source info needed to create target report infos, collected in the main thread
+    struct TargetReportInfoContext
+    {
+        std::map<std::string, unsigned int>            dbcont_ids; // dbcont name -> id
+        std::set<unsigned int>                         unused_ds_ids;
+        std::map<unsigned int, std::set<unsigned int>> unused_lines;
+        std::set<unsigned int>                         ground_only_ds_ids;
+        std::set<unsigned int>                         calc_ref_ds_ids; // ds ids of calculated references
+    };
+
+    TargetReportInfoContext targetReportInfoContext() const; // main thread only
+    void prepareSlice(DataSlice& slice, const TargetReportInfoContext& context) const; // may run in parallel to processSlice of previous slice
     void processSlice();
     ReconstructorBase::DataSlice& currentSlice();
     const ReconstructorBase::DataSlice& currentSlice() const;
@@ -270,13 +300,13 @@ public:
     void saveTargets();
 
     // our data structures
-    std::map<unsigned long, dbContent::targetReport::ReconstructorInfo> target_reports_;
+    ReconstructorInfoStore target_reports_;
     unsigned int num_new_target_reports_in_slice_{0};
     unsigned int num_new_target_reports_total_{0};
     unsigned int num_unassociated_target_reports_total_{0};
 
     // all sources, record_num -> base info
-    std::multimap<boost::posix_time::ptime, unsigned long> tr_timestamps_;
+    std::multimap<Utils::Time::Timestamp, unsigned long> tr_timestamps_;
     // all sources sorted by time, ts -> record_num
     std::map<unsigned int, std::map<unsigned int, std::map<unsigned int, std::vector<unsigned long>>>> tr_ds_;
     // dbcontent id -> ds_id -> line id -> record_num, sorted by ts
@@ -305,6 +335,7 @@ public:
     boost::optional<unsigned int> utnForACAD(unsigned int acad);
 
     std::unique_ptr<reconstruction::KalmanChain>& chain(unsigned int utn);
+    void reestimateChains(const std::vector<unsigned int>& utns); // used for merged targets only
 
     void informConfigChanged();
     void resetTimeframeSettings();
@@ -339,6 +370,9 @@ protected:
 
     void clearOldTargetReports();
     void createTargetReports();
+    void createTargetReportInfo(const dbContent::TargetReportAccessor& tgt_acc, unsigned int index,
+                                unsigned int dbcont_id, const TargetReportInfoContext& context,
+                                dbContent::targetReport::ReconstructorInfo& info) const;
     void removeTargetReportsLaterOrEqualThan(const boost::posix_time::ptime& ts); // for slice recalc
 
     std::map<unsigned int, std::map<unsigned long, unsigned int>> createAssociations();
@@ -0,0 +1,130 @@
+/*
+ * This file is part of OpenATS COMPASS.
+ *
+ * COMPASS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * COMPASS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with COMPASS. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "targetreportdefs.h"
+
+#include <cassert>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Store for the reconstructor infos of all target reports in the current slices.
+ *
+ * Infos are kept contiguously in insertion order and addressed by a dense id, a hash map resolves
+ * record numbers to ids. Removal of outdated infos compacts the array in a single pass and keeps
+ * the capacity, so that the memory is reused by the following slices.
+ *
+ * References to infos are invalidated by add() and removeIf().
+ */
+class ReconstructorInfoStore
+{
+public:
+    typedef dbContent::targetReport::ReconstructorInfo Info;
+    typedef std::vector<Info>::iterator                iterator;
+    typedef std::vector<Info>::const_iterator          const_iterator;
+
+    ReconstructorInfoStore() = default;
+    virtual ~ReconstructorInfoStore() = default;
+
+    size_t size() const { return infos_.size(); }
+    bool empty() const { return infos_.empty(); }
+
+    void clear()
+    {
+        std::vector<Info>().swap(infos_);
+        ids_.clear();
+    }
+
+    size_t count(unsigned long rec_num) const { return ids_.count(rec_num); }
+
+    Info& at(unsigned long rec_num) { return infos_[ ids_.at(rec_num) ]; }
+    const Info& at(unsigned long rec_num) const { return infos_[ ids_.at(rec_num) ]; }
+
+    // returns nullptr if not found
+    Info* find(unsigned long rec_num)
+    {
+        auto it = ids_.find(rec_num);
+        return it == ids_.end() ? nullptr : &infos_[ it->second ];
+    }
+    const Info* find(unsigned long rec_num) const
+    {
+        auto it = ids_.find(rec_num);
+        return it == ids_.end() ? nullptr : &infos_[ it->second ];
+    }
+
+    // adds the info or replaces an existing one with the same record number
+    Info& add(Info&& info)
+    {
+        auto it = ids_.find(info.record_num_);
+        if (it != ids_.end())
+        {
+            infos_[ it->second ] = std::move(info);
+            return infos_[ it->second ];
+        }
+
+        ids_.emplace(info.record_num_, (unsigned int)infos_.size());
+        infos_.push_back(std::move(info));
+
+        return infos_.back();
+    }
+
+    // removes all infos for which pred returns true, keeps the order of the remaining infos
+    template <typename Pred>
+    size_t removeIf(Pred pred)
+    {
+        size_t num_kept = 0;
+
+        for (size_t cnt = 0; cnt < infos_.size(); ++cnt)
+        {
+            if (pred(infos_[ cnt ]))
+                continue;
+
+            if (num_kept != cnt)
+                infos_[ num_kept ] = std::move(infos_[ cnt ]);
+
+            ++num_kept;
+        }
+
+        size_t num_removed = infos_.size() - num_kept;
+
+        if (!num_removed)
+            return 0;
+
+        infos_.erase(infos_.begin() + num_kept, infos_.end());
+
+        ids_.clear();
+        ids_.reserve(infos_.size());
+
+        for (size_t cnt = 0; cnt < infos_.size(); ++cnt)
+            ids_.emplace(infos_[ cnt ].record_num_, (unsigned int)cnt);
+
+        assert (ids_.size() == infos_.size());
+
+        return num_removed;
+    }
+
+    iterator begin() { return infos_.begin(); }
+    iterator end() { return infos_.end(); }
+    const_iterator begin() const { return infos_.begin(); }
+    const_iterator end() const { return infos_.end(); }
+
+private:
+    std::vector<Info>                               infos_;
+    std::unordered_map<unsigned long, unsigned int> ids_; // record number -> index in infos_
+};
@@ -82,8 +82,15 @@ void ReconstructorTarget::addTargetReport (unsigned long rec_num,
     addTargetReport(rec_num, add_to_tracker, true);
 }
 
+void ReconstructorTarget::addTargetReport (unsigned long rec_num,
+                                          reconstruction::UpdateStats& stats)
+{
+    addTargetReport(rec_num, true, true, &stats);
+}
+
 void ReconstructorTarget::addTargetReports (const ReconstructorTarget& other,
-                                            bool add_to_tracker)
+                                            bool add_to_tracker,
+                                            bool reestimate)
 {
     //add single tr without reestimating
     size_t num_added = 0;
@@ -92,7 +99,7 @@ void ReconstructorTarget::addTargetReports (const ReconstructorTarget& other,
             ++num_added;
 
     //reestimate chain after adding
-    if (add_to_tracker && chain())
+    if (add_to_tracker && reestimate && chain())
     {
         reconstruction::UpdateStats stats;
         bool ok = chain()->reestimate(&stats);
@@ -110,7 +117,8 @@ void ReconstructorTarget::addTargetReports (const ReconstructorTarget& other,
 
 ReconstructorTarget::TargetReportAddResult ReconstructorTarget::addTargetReport (unsigned long rec_num,
                                                                                  bool add_to_tracker,
-                                                                                 bool reestimate)
+                                                                                 bool reestimate,
+                                                                                 reconstruction::UpdateStats* stats)
 {
     bool do_debug = false;
 
@@ -218,7 +226,7 @@ ReconstructorTarget::TargetReportAddResult ReconstructorTarget::addTargetReport
         mode_as_.insert(tr.mode_a_code_->code_);
 
     target_reports_.push_back(tr.record_num_);
-    tr_timestamps_.insert({tr.timestamp_,tr.record_num_});
+    tr_timestamps_.insert({Time::Timestamp(tr.timestamp_),tr.record_num_});
     // all sources sorted by time, ts -> record_num
     tr_ds_timestamps_[Number::recNumGetDBContId(tr.record_num_)][tr.ds_id_][tr.line_id_].insert(
         {tr.timestamp_, tr.record_num_});
@@ -325,26 +333,29 @@ ReconstructorTarget::TargetReportAddResult ReconstructorTarget::addTargetReport
             reinitTracker();
         }
 
-        reconstruction::UpdateStats stats;
+        reconstruction::UpdateStats tr_stats;
 
         if (do_debug)
             loginf << "DBG add to tracker: addToTracker";
 
-        result = addToTracker(tr, reestimate, &stats);
+        result = addToTracker(tr, reestimate, &tr_stats);
 
         if (reestimate && result != TargetReportAddResult::Skipped)
         {
-            assert(stats.num_replaced <= 2);
-            assert(stats.num_fresh <= 2);
-            assert(stats.num_replaced >= 0 || stats.num_fresh == 1);
-            assert(stats.num_updated >= 1);
-            assert(stats.num_failed + stats.num_skipped + stats.num_valid == stats.num_updated);
+            assert(tr_stats.num_replaced <= 2);
+            assert(tr_stats.num_fresh <= 2);
+            assert(tr_stats.num_replaced >= 0 || tr_stats.num_fresh == 1);
+            assert(tr_stats.num_updated >= 1);
+            assert(tr_stats.num_failed + tr_stats.num_skipped + tr_stats.num_valid == tr_stats.num_updated);
         }
 
         if (do_debug)
             loginf << "DBG add to tracker: add to stats";
 
-        addUpdateToGlobalStats(stats);
+        if (stats)
+            *stats = tr_stats;
+        else
+            addUpdateToGlobalStats(tr_stats);
     }
 
     if (do_debug)
@@ -551,39 +562,42 @@ bool ReconstructorTarget::hasDataForTime (ptime timestamp, time_duration d_max)
     if (!tr_timestamps_.size() || !isTimeInside(timestamp, d_max))
         return false;
 
-    if (tr_timestamps_.count(timestamp))
+    const Time::Timestamp ts(timestamp);
+    const int64_t d_max_us = Time::Timestamp::microseconds(d_max);
+
+    if (tr_timestamps_.count(ts))
         return true; // contains exact value(s)
 
     //    Return iterator to lower bound
     //    Returns an iterator pointing to the first element in the container whose key is not considered to go
     //    before k (i.e., either it is equivalent or goes after).
 
-    auto it_upper = tr_timestamps_.lower_bound(timestamp);
+    auto it_upper = tr_timestamps_.lower_bound(ts);
 
     // all tr_timestamps_ smaller than timestamp
     if (it_upper == tr_timestamps_.end())
     {
-        assert (tr_timestamps_.rbegin()->first <= timestamp);
-        return (timestamp - tr_timestamps_.rbegin()->first) < d_max;
+        assert (tr_timestamps_.rbegin()->first <= ts);
+        return (ts - tr_timestamps_.rbegin()->first) < d_max_us;
     }
 
     // all tr_timestamps_ bigger than timestamp
     if (it_upper == tr_timestamps_.begin())
     {
-        assert (tr_timestamps_.begin()->first >= timestamp);
-        return (tr_timestamps_.begin()->first - timestamp) < d_max;
+        assert (tr_timestamps_.begin()->first >= ts);
+        return (tr_timestamps_.begin()->first - ts) < d_max_us;
     }
 
     // have lb_it which has >= timestamp
-    assert (it_upper->first >= timestamp);
+    assert (it_upper->first >= ts);
 
-    if (timestamp - it_upper->first < d_max)
+    if (ts - it_upper->first < d_max_us)
         return true; // got one in d_max
 
     it_upper--;
 
-    assert (it_upper->first < timestamp);
-    return (timestamp - tr_timestamps_.begin()->first) < d_max;
+    assert (it_upper->first < ts);
+    return (ts - tr_timestamps_.begin()->first) < d_max_us;
 
     // save value
     // ptime upper = lb_it->first;
@@ -656,12 +670,15 @@ ReconstructorTarget::ReconstructorInfoPair ReconstructorTarget::dataFor (ptime t
 {
     bool debug = false; //interp_options.debug();
 
-    std::multimap<boost::posix_time::ptime, unsigned long>::const_iterator it_lower, it_upper;
+    const Time::Timestamp ts(timestamp);
+    const int64_t d_max_us = Time::Timestamp::microseconds(d_max);
+
+    std::multimap<Time::Timestamp, unsigned long>::const_iterator it_lower, it_upper;
     bool has_lower = false;
     bool has_upper = false;
 
-    auto num_ts_existing = tr_timestamps_.count(timestamp);
-    auto range = tr_timestamps_.equal_range(timestamp);
+    auto num_ts_existing = tr_timestamps_.count(ts);
+    auto range = tr_timestamps_.equal_range(ts);
 
     //look for initial upper and lower datum
     if (num_ts_existing == 1)
@@ -682,7 +699,7 @@ ReconstructorTarget::ReconstructorInfoPair ReconstructorTarget::dataFor (ptime t
         assert(range.first != tr_timestamps_.end());
 
         //multiple timestamps in map => choose one depending on init mode
-        std::multimap<boost::posix_time::ptime, unsigned long>::const_iterator it_start = tr_timestamps_.end();
+        std::multimap<Time::Timestamp, unsigned long>::const_iterator it_start = tr_timestamps_.end();
 
         auto init_mode = interp_options.initMode();
 
@@ -740,13 +757,13 @@ ReconstructorTarget::ReconstructorInfoPair ReconstructorTarget::dataFor (ptime t
     else
     {
         //get lower bound
-        it_upper = tr_timestamps_.lower_bound(timestamp);
+        it_upper = tr_timestamps_.lower_bound(ts);
 
         // all tr_timestamps_ smaller than timestamp
         if (it_upper == tr_timestamps_.end())
         {
-            assert (tr_timestamps_.rbegin()->first <= timestamp);
-            if ((timestamp - tr_timestamps_.rbegin()->first) < d_max)
+            assert (tr_timestamps_.rbegin()->first <= ts);
+            if ((ts - tr_timestamps_.rbegin()->first) < d_max_us)
             {
                 it_lower  = std::prev(tr_timestamps_.end());
                 it_upper  = tr_timestamps_.end();
@@ -756,9 +773,9 @@ ReconstructorTarget::ReconstructorInfoPair ReconstructorTarget::dataFor (ptime t
         }
         else if (it_upper == tr_timestamps_.begin())// all tr_timestamps_ bigger than timestamp
         {
-            assert (tr_timestamps_.begin()->first >= timestamp);
+            assert (tr_timestamps_.begin()->first >= ts);
 
-            if ((tr_timestamps_.begin()->first - timestamp) < d_max)
+            if ((tr_timestamps_.begin()->first - ts) < d_max_us)
             {
                 it_lower  = tr_timestamps_.end();
                 //it_upper  = tr_timestamps_.begin(); // is already on this value
@@ -768,20 +785,20 @@ ReconstructorTarget::ReconstructorInfoPair ReconstructorTarget::dataFor (ptime t
         }
         else
         {
-            assert (it_upper->first >= timestamp);
+            assert (it_upper->first >= ts);
 
             //too much time difference?
-            if (it_upper->first - timestamp <= d_max)
+            if (it_upper->first - ts <= d_max_us)
                 has_upper = true;
 
             //set lower iterator to last elem
             it_lower = it_upper;
             --it_lower;
 
-            assert (it_lower->first < timestamp);
+            assert (it_lower->first < ts);
 
             //lower item too far away?
-            if (timestamp - it_lower->first <= d_max)
+            if (ts - it_lower->first <= d_max_us)
                 has_lower = true;
         }
         if (debug) 
@@ -811,7 +828,7 @@ ReconstructorTarget::ReconstructorInfoPair ReconstructorTarget::dataFor (ptime t
         has_upper = false;
         for (auto it = it_upper; it != tr_timestamps_.end(); ++it)
         {
-            if (it->first - timestamp > d_max)
+            if (it->first - ts > d_max_us)
                 break;
 
             auto skip_result = skipTargetReport(dataFor(it->second), tr_valid_func);
@@ -835,7 +852,7 @@ ReconstructorTarget::ReconstructorInfoPair ReconstructorTarget::dataFor (ptime t
         auto it = it_lower;
         while (1)
         {
-            if (timestamp - it->first > d_max)
+            if (ts - it->first > d_max_us)
                 break;
 
             auto skip_result = skipTargetReport(dataFor(it->second), tr_valid_func);
@@ -1903,8 +1920,8 @@ AltitudeState ReconstructorTarget::getAltitudeStateStruct(const boost::posix_tim
 
 TimedDataSeries<unsigned int> ReconstructorTarget::getMode3ASeries() const
 {
-    auto ts_begin = tr_timestamps_.begin()->first;
-    auto ts_end = tr_timestamps_.rbegin()->first;
+    auto ts_begin = tr_timestamps_.begin()->first.toPTime();
+    auto ts_end = tr_timestamps_.rbegin()->first.toPTime();
 
     float value_usage_seconds = 10; //+/-
 
@@ -1956,15 +1973,15 @@ TimedDataSeries<unsigned int> ReconstructorTarget::getMode3ASeries() const
         ts_begin, ts_end, value_usage_seconds, confidence_func, value_func);
 
     for (auto tr_it : tr_timestamps_)
-        ts.insert(tr_it.first, tr_it.second); // , utn_ == 8
+        ts.insert(tr_it.first.toPTime(), tr_it.second); // , utn_ == 8
 
     return ts;
 }
 
 TimedDataSeries<float> ReconstructorTarget::getAltitudeSeries() const
 {
-    auto ts_begin = tr_timestamps_.begin()->first;
-    auto ts_end = tr_timestamps_.rbegin()->first;
+    auto ts_begin = tr_timestamps_.begin()->first.toPTime();
+    auto ts_end = tr_timestamps_.rbegin()->first.toPTime();
 
     float value_usage_seconds = 5; //+/-
 
@@ -2015,15 +2032,15 @@ TimedDataSeries<float> ReconstructorTarget::getAltitudeSeries() const
         ts_begin, ts_end, value_usage_seconds, confidence_func, value_func);
 
     for (auto tr_it : tr_timestamps_)
-        ts.insert(tr_it.first, tr_it.second); // , utn_ == 8
+        ts.insert(tr_it.first.toPTime(), tr_it.second); // , utn_ == 8
 
     return ts;
 }
 
 TimedDataSeries<bool> ReconstructorTarget::getGroundBitSeries() const
 {
-    auto ts_begin = tr_timestamps_.begin()->first;
-    auto ts_end = tr_timestamps_.rbegin()->first;
+    auto ts_begin = tr_timestamps_.begin()->first.toPTime();
+    auto ts_end = tr_timestamps_.rbegin()->first.toPTime();
 
     float altitude_usage_seconds = 5; //+/-
 
@@ -2066,7 +2083,7 @@ TimedDataSeries<bool> ReconstructorTarget::getGroundBitSeries() const
         ts_begin, ts_end, altitude_usage_seconds, confidence_func, value_func);
 
     for (auto tr_it : tr_timestamps_)
-        ts.insert(tr_it.first, tr_it.second); // , utn_ == 8
+        ts.insert(tr_it.first.toPTime(), tr_it.second); // , utn_ == 8
 
     return ts;
 }
@@ -2568,6 +2585,8 @@ void ReconstructorTarget::removeOutdatedTargetReports()
 
 void ReconstructorTarget::removeTargetReportsLaterOrEqualThan(boost::posix_time::ptime ts)
 {
+    const Time::Timestamp ts_remove(ts);
+
     auto tmp_tr_timestamps = std::move(tr_timestamps_);
 
     target_reports_.clear();
@@ -2583,10 +2602,10 @@ void ReconstructorTarget::removeTargetReportsLaterOrEqualThan(boost::posix_time:
         assert (reconstructor_.target_reports_.count(ts_it.second));
 
         dbContent::targetReport::ReconstructorInfo& tr = reconstructor_.target_reports_.at(ts_it.second);
-        assert (tr.timestamp_ == ts_it.first);
+        assert (Time::Timestamp(tr.timestamp_) == ts_it.first);
 #endif
 
-        if (ts_it.first < ts) // add if older than ts
+        if (ts_it.first < ts_remove) // add if older than ts
             addTargetReport(ts_it.second, false, false);
         else
             break;
@@ -2649,7 +2668,7 @@ void ReconstructorTarget::reinitTracker()
     chain()->setMeasurementCheckFunc(
         [ rec_ptr ] (unsigned long rec_num)
         {
-            return rec_ptr->target_reports_.find(rec_num) != rec_ptr->target_reports_.end();
+            return rec_ptr->target_reports_.count(rec_num) > 0;
         });
 }
 
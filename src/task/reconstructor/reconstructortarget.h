@@ -5,6 +5,7 @@
 #include "reconstruction_defs.h"
 #include "reconstructorbase.h"
 #include "targetbase.h"
+#include "timestamp.h"
 
 #include <boost/date_time/posix_time/ptime.hpp>
 #include <boost/optional.hpp>
@@ -177,7 +178,7 @@ public:
 
     // target report aggregation & search structures, by record numbers
     std::vector<unsigned long> target_reports_;
-    std::multimap<boost::posix_time::ptime, unsigned long> tr_timestamps_;
+    std::multimap<Utils::Time::Timestamp, unsigned long> tr_timestamps_; // ts -> record_num
     // all sources sorted by time, ts -> record_num
     std::map<unsigned int, std::map<unsigned int,
                                     std::map<unsigned int,
@@ -222,8 +223,12 @@ public:
 
     void addTargetReport (unsigned long rec_num,
                          bool add_to_tracker = true);
+    // does not add to global stats, chain update stats are returned in stats instead
+    void addTargetReport (unsigned long rec_num,
+                         reconstruction::UpdateStats& stats);
     void addTargetReports (const ReconstructorTarget& other,
-                          bool add_to_tracker = true);
+                          bool add_to_tracker = true,
+                          bool reestimate = true); // if false, chain has to be reestimated by caller
 
     unsigned int numAssociated() const;
     unsigned long lastAssociated() const;
@@ -411,7 +416,8 @@ protected:
 
     TargetReportAddResult addTargetReport (unsigned long rec_num,
                                            bool add_to_tracker,
-                                           bool reestimate);
+                                           bool reestimate,
+                                           reconstruction::UpdateStats* stats = nullptr);
 
     TargetReportSkipResult skipTargetReport (const dbContent::targetReport::ReconstructorInfo& tr,
                                             const InfoValidFunc& tr_valid_func = InfoValidFunc()) const;
@@ -69,6 +69,9 @@ ReconstructorTask::ReconstructorTask(const std::string& class_id, const std::str
 
     registerParameter("skip_reference_data_writing", &skip_reference_data_writing_, false);
 
+    registerParameter("pipeline_slices", &pipeline_slices_, true);
+    registerParameter("max_slices_in_flight", &max_slices_in_flight_, 3u);
+
     if (!current_reconstructor_str_.size()
         || (current_reconstructor_str_ != ScoringUMReconstructorName
 #if USE_EXPERIMENTAL_SOURCE == true
@@ -392,6 +395,10 @@ void ReconstructorTask::run()
     processing_data_slice_ = false;
     writing_slice_ = nullptr;
 
+    pending_slices_.clear();
+    preparing_slice_ = nullptr;
+    last_slice_loaded_ = false;
+
     cancelled_ = false;
     done_ = false;
 
@@ -401,6 +408,7 @@ void ReconstructorTask::run()
     deltgts_future_ = {};
     delassocs_future_ = {};
     process_future_ = {};
+    prepare_future_ = {};
 
     COMPASS::instance().dbContentManager().clearAssociationsIdentifier();
     COMPASS::instance().dbInterface().startPerformanceMetrics();
@@ -612,24 +620,24 @@ void ReconstructorTask::loadDataSlice()
     }
 }
 
-void ReconstructorTask::processDataSlice()
+void ReconstructorTask::processDataSlice(std::unique_ptr<ReconstructorBase::DataSlice>& slice)
 {
     loginf << "ReconstructorTask: processDataSlice";
 
     if (cancelled_)
         return;
 
-    assert (loading_slice_);
+    assert (slice);
     assert (!processing_slice_);
 
-    processing_slice_ = std::move(loading_slice_);
+    processing_slice_ = std::move(slice);
 
     assert (!processing_data_slice_);
 
     if (!processing_slice_->data_.size())
     {
         logdbg << "ReconstructorTask: processDataSlice: empty buffer at ("
-               << Time::toString(loading_slice_->slice_begin_)<< ", no process";
+               << Time::toString(processing_slice_->slice_begin_)<< ", no process";
 
         processing_slice_ = nullptr;
 
@@ -733,12 +741,42 @@ void ReconstructorTask::loadingDoneSlot()
            << " current_slice_idx " << current_slice_idx_;
 
     loading_slice_->data_ = dbcontent_man.data();
+    loading_slice_->loading_done_ = true;
 
     dbcontent_man.clearData(); // clear previous
 
     if (cancelled_)
         return;
 
+    if (pipeline_slices_)
+    {
+        last_slice_loaded_ = last_slice;
+
+        pending_slices_.push_back(std::move(loading_slice_));
+
+        prepareNextSlice();
+        processNextSlice();
+
+        if (cancelled_)
+            return;
+
+        if (last_slice) // disconnect everything
+        {
+            disconnect(&dbcontent_man, &DBContentManager::loadedDataSignal,
+                       this, &ReconstructorTask::loadedDataSlot);
+            disconnect(&dbcontent_man, &DBContentManager::loadingDoneSignal,
+                       this, &ReconstructorTask::loadingDoneSlot);
+
+            COMPASS::instance().viewManager().disableDataDistribution(false);
+        }
+        else
+        {
+            loadNextSliceIfPossible();
+        }
+
+        return;
+    }
+
     // check if not already processing
     while (currentReconstructor()->processing() || processing_data_slice_)
     {
@@ -776,7 +814,7 @@ void ReconstructorTask::loadingDoneSlot()
 
     if (loading_slice_->data_.size())
     {
-        processDataSlice();
+        processDataSlice(loading_slice_);
 
         assert (!loading_slice_);
         assert (processing_data_slice_);
@@ -856,6 +894,9 @@ void ReconstructorTask::processingDoneSlot()
     {
         writeDataSlice(); // starts the async jobs
     }
+
+    if (pipeline_slices_)
+        processNextSlice();
 }
 
 void ReconstructorTask::writeDoneSlot()
@@ -896,6 +937,148 @@ void ReconstructorTask::finalizeSlice(std::unique_ptr<ReconstructorBase::DataSli
 
     // free slice
     slice.reset();
+
+    if (pipeline_slices_ && !done_)
+    {
+        processNextSlice(); // might be waiting for last empty slice
+        loadNextSliceIfPossible();
+    }
+}
+
+unsigned int ReconstructorTask::numSlicesInFlight() const
+{
+    return (loading_slice_ ? 1 : 0) + pending_slices_.size()
+            + (processing_slice_ ? 1 : 0) + (writing_slice_ ? 1 : 0);
+}
+
+/**
+ * Pipeline mode: loads the next slice if the number of slices in flight allows it.
+ */
+void ReconstructorTask::loadNextSliceIfPossible()
+{
+    if (cancelled_ || done_ || last_slice_loaded_ || loading_slice_)
+        return;
+
+    if (numSlicesInFlight() >= std::max(1u, max_slices_in_flight_))
+    {
+        logdbg << "ReconstructorTask: loadNextSliceIfPossible: " << numSlicesInFlight() << " slices in flight";
+        return;
+    }
+
+    loginf << "ReconstructorTask: loadNextSliceIfPossible: next slice";
+
+    loadDataSlice();
+}
+
+/**
+ * Pipeline mode: creates the target report infos of the oldest unprepared pending slice in the background.
+ */
+void ReconstructorTask::prepareNextSlice()
+{
+    if (cancelled_ || preparing_slice_)
+        return;
+
+    for (auto& slice : pending_slices_)
+    {
+        if (slice->target_reports_prepared_)
+            continue;
+
+        preparing_slice_ = slice.get();
+        break;
+    }
+
+    if (!preparing_slice_)
+        return;
+
+    logdbg << "ReconstructorTask: prepareNextSlice: slice " << preparing_slice_->slice_count_;
+
+    // collect manager and task info here in the main thread, the preparation only accesses the slice and the context
+    ReconstructorBase* reconstructor = currentReconstructor();
+    assert (reconstructor);
+
+    ReconstructorBase::DataSlice* slice = preparing_slice_;
+
+    prepare_future_ = std::async(std::launch::async,
+                                 [ this, reconstructor, slice, context = reconstructor->targetReportInfoContext() ] {
+        try
+        {
+            reconstructor->prepareSlice(*slice, context);
+
+            QMetaObject::invokeMethod(this, "preparingDoneSlot", Qt::QueuedConnection);
+        }
+        catch (std::exception& e)
+        {
+            loginf << "ReconstructorTask: run: preparing slice threw exception '" << e.what() << "'";
+            assert (false);
+        }
+    });
+}
+
+void ReconstructorTask::preparingDoneSlot()
+{
+    logdbg << "ReconstructorTask: preparingDoneSlot";
+
+    assert (preparing_slice_);
+    preparing_slice_ = nullptr;
+
+    if (cancelled_)
+        return;
+
+    prepareNextSlice();
+    processNextSlice();
+}
+
+/**
+ * Pipeline mode: starts processing of the oldest pending slice, if prepared and not already processing.
+ */
+void ReconstructorTask::processNextSlice()
+{
+    while (!cancelled_ && !processing_slice_ && !processing_data_slice_
+           && pending_slices_.size() && pending_slices_.front().get() != preparing_slice_)
+    {
+        std::unique_ptr<ReconstructorBase::DataSlice>& slice = pending_slices_.front();
+
+        if (slice->data_.size() && !slice->target_reports_prepared_)
+            return; // not yet prepared
+
+        if (!slice->data_.size())
+        {
+            loginf << "ReconstructorTask: processNextSlice: empty buffer at "
+                   << Time::toString(slice->slice_begin_) << ", no process";
+
+            if (slice->is_last_slice_)
+            {
+                if (writing_slice_) // finalize after previous slices written
+                    return;
+
+                loginf << "ReconstructorTask: processNextSlice: finalizing last empty slice";
+
+                pending_slices_.pop_front();
+
+                endReconstruction();
+                // release unused memory
+                malloc_trim(0);
+
+                return;
+            }
+
+            pending_slices_.pop_front();
+
+            loadNextSliceIfPossible();
+
+            continue;
+        }
+
+        loginf << "ReconstructorTask: processNextSlice: calling process, pending " << pending_slices_.size();
+
+        updateProgressSlot("Processing Slice", true);
+        ++current_slice_idx_;
+
+        processDataSlice(slice);
+        pending_slices_.pop_front();
+
+        assert (processing_data_slice_);
+    }
 }
 
 void ReconstructorTask::endReconstruction()
@@ -1060,7 +1243,7 @@ void ReconstructorTask::runCancelledSlot()
 
     while (loading_data_ || dbcontent_man.loadInProgress()
            || processing_data_slice_ || currentReconstructor()->processing()
-           || dbcontent_man.insertInProgress())
+           || preparing_slice_ || dbcontent_man.insertInProgress())
     {
         logdbg << "ReconstructorTask: runCancelledSlot: waiting, load "
                << (loading_data_ || dbcontent_man.loadInProgress())
@@ -1087,6 +1270,9 @@ void ReconstructorTask::runCancelledSlot()
     processing_slice_ = nullptr;
     writing_slice_ = nullptr;
 
+    pending_slices_.clear();
+    preparing_slice_ = nullptr;
+
     done_ = true;
     malloc_trim(0); // release unused memory
 
@@ -1278,6 +1464,26 @@ std::unique_ptr<ViewPointGenVP> ReconstructorTask::getDebugViewpointForUTN(unsig
 //     debug_viewpoints_.clear();
 // }
 
+bool ReconstructorTask::pipelineSlices() const
+{
+    return pipeline_slices_;
+}
+
+void ReconstructorTask::pipelineSlices(bool value)
+{
+    pipeline_slices_ = value;
+}
+
+unsigned int ReconstructorTask::maxSlicesInFlight() const
+{
+    return max_slices_in_flight_;
+}
+
+void ReconstructorTask::maxSlicesInFlight(unsigned int value)
+{
+    max_slices_in_flight_ = value;
+}
+
 bool ReconstructorTask::skipReferenceDataWriting() const
 {
     return skip_reference_data_writing_;
@@ -12,6 +12,7 @@
 
 #include <memory>
 #include <future>
+#include <deque>
 
 //#include "boost/date_time/posix_time/posix_time.hpp"
 
@@ -85,6 +86,7 @@ public slots:
     void loadedDataSlot(const std::map<std::string, std::shared_ptr<Buffer>>& data, bool requires_reset);
     void loadingDoneSlot();
 
+    void preparingDoneSlot();
     void processingDoneSlot();
     void writeDoneSlot();
 
@@ -139,6 +141,11 @@ public:
     bool skipReferenceDataWriting() const;
     void skipReferenceDataWriting(bool newSkip_reference_data_writing);
 
+    bool pipelineSlices() const;
+    void pipelineSlices(bool value);
+    unsigned int maxSlicesInFlight() const;
+    void maxSlicesInFlight(unsigned int value);
+
     void showDialog();
 
     void checkReconstructor();
@@ -153,8 +160,13 @@ protected:
     void deleteCalculatedReferences();
 
     void loadDataSlice();
-    void processDataSlice();
+    void processDataSlice(std::unique_ptr<ReconstructorBase::DataSlice>& slice);
     void writeDataSlice();
+
+    unsigned int numSlicesInFlight() const;
+    void loadNextSliceIfPossible();
+    void prepareNextSlice();
+    void processNextSlice();
     void endReconstruction();
 
     void finalizeSlice(std::unique_ptr<ReconstructorBase::DataSlice>& slice);
@@ -182,16 +194,25 @@ protected:
     std::unique_ptr<ReconstructorBase::DataSlice> processing_slice_;
     std::unique_ptr<ReconstructorBase::DataSlice> writing_slice_;
 
+    // pipeline mode: loaded slices in order, prepared while previous slices are processed
+    std::deque<std::unique_ptr<ReconstructorBase::DataSlice>> pending_slices_;
+    ReconstructorBase::DataSlice* preparing_slice_ {nullptr}; // in pending_slices_
+    bool last_slice_loaded_ {false};
+
     DebugSettings debug_settings_;
 
     std::future<void> delcalcref_future_;
     std::future<void> deltgts_future_;
     std::future<void> delassocs_future_;
     std::future<void> process_future_;
+    std::future<void> prepare_future_;
     bool processing_data_slice_ {false};
     bool cancelled_ {false};
 
     bool skip_reference_data_writing_ {false};
 
+    bool pipeline_slices_ {true};
+    unsigned int max_slices_in_flight_ {3}; // loaded, processing and writing slices
+
     //mutable std::map<std::pair<std::string,std::string>, std::unique_ptr<ViewPointGenVP>> debug_viewpoints_;
 };
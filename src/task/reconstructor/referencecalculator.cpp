@@ -179,6 +179,10 @@ void ReferenceCalculator::reset()
     references_.clear();
     interp_options_.clear();
 
+    //free scratch memory
+    scratch_.clear();
+    Measurements().swap(line_measurements_);
+
     slice_idx_ = 0;
 }
 
@@ -260,7 +264,9 @@ void ReferenceCalculator::generateLineMeasurements(const dbContent::Reconstructo
     if (settings_.compat_mode && dbcontent_id != 21 && dbcontent_id != 62)
         return;
 
-    std::vector<reconstruction::Measurement> line_measurements;
+    //reuse capacity of last line
+    line_measurements_.clear();
+    line_measurements_.reserve(target_reports.size());
 
     assert (reconstructor_.acc_estimator_);
 
@@ -271,7 +277,8 @@ void ReferenceCalculator::generateLineMeasurements(const dbContent::Reconstructo
         if (tr_info.doNotUsePosition())
             continue;
 
-        reconstruction::Measurement mm;
+        line_measurements_.emplace_back();
+        reconstruction::Measurement& mm = line_measurements_.back();
         reconstructor_.createMeasurement(mm, tr_info, &target);
 
         // if (tr_info.track_number_.value() == 69 || target.utn_ == 69)
@@ -279,11 +286,9 @@ void ReferenceCalculator::generateLineMeasurements(const dbContent::Reconstructo
         //     loginf << "POS (" << mm.lat << "," << mm.lon << ") " << "(" << (mm.vx.has_value() ? mm.vx.value() : 666) << "," << (mm.vy.has_value() ? mm.vy.value() : 666) << ")";
         //     loginf << "ACC (" << mm.x_stddev.value() << "," << mm.y_stddev.value() << "," << mm.xy_cov.value() << ") " << "(" << mm.vx_stddev.value() << "," << mm.vy_stddev.value() << ")";
         // }
-
-        line_measurements.push_back(mm);
     }
 
-    addMeasurements(target.utn_, dbcontent_id, line_measurements);
+    addMeasurements(target.utn_, dbcontent_id, line_measurements_);
 }
 
 /**
@@ -358,7 +363,7 @@ void ReferenceCalculator::interpolateMeasurements(Measurements& measurements,
     measurements.resize(ni);
 
     for (size_t i = 0; i < ni; ++i)
-        measurements[ i ] = mms_interp[ i ];
+        measurements[ i ] = std::move(mms_interp[ i ]);
 }
 
 /**
@@ -379,6 +384,8 @@ void ReferenceCalculator::reconstructMeasurements()
     loginf << "ReferenceCalculator: reconstructMeasurements: reconstructing " << num_targets
            << " target(s) " << (settings_.multithreading ? "multithreaded" : "") << "...";
 
+    boost::posix_time::ptime start_time = boost::posix_time::microsec_clock::local_time();
+
     //compute references in parallel
     if (settings_.multithreading)
     {
@@ -395,7 +402,15 @@ void ReferenceCalculator::reconstructMeasurements()
         }
     }
 
-    loginf << "ReferenceCalculator: reconstructMeasurements: done";
+    double time_s = Time::partialSeconds(boost::posix_time::microsec_clock::local_time() - start_time);
+
+    size_t num_refs = 0;
+    for (auto ref : refs)
+        num_refs += ref->references.size();
+
+    loginf << "ReferenceCalculator: reconstructMeasurements: done, computed " << num_refs << " reference(s) in "
+           << String::doubleToStringPrecision(time_s, 2) << "s ("
+           << (time_s > 0 ? String::doubleToStringPrecision(num_refs / time_s, 0) : "inf") << " refs/s)";
 }
 
 /**
@@ -820,7 +835,10 @@ void ReferenceCalculator::reconstructMeasurements(TargetReferences& refs)
     if(settings_.activeVerbosity() > 0 || debug_target) 
         loginf << "ReferenceCalculator: reconstructMeasurements [UTN = " << refs.utn << "]";
 
-    std::vector<kalman::KalmanUpdate> updates;
+    //update vectors are reused by this thread, assignments keep the memory of existing elements
+    ReconstructionScratch& scratch = scratch_.local();
+
+    std::vector<kalman::KalmanUpdate>& updates = scratch.updates;
 
     //configure and init estimator
     reconstruction::KalmanEstimator estimator;
@@ -876,12 +894,12 @@ void ReferenceCalculator::reconstructMeasurements(TargetReferences& refs)
 
         //interpolate measurements
         size_t num_failed_steps;
-        std::vector<kalman::KalmanUpdate> updates_interp;
+        std::vector<kalman::KalmanUpdate>& updates_interp = scratch.updates_interp;
         estimator_resample.interpUpdates(updates_interp, updates, &num_failed_steps);
 
         refs.num_interp_steps_failed += num_failed_steps;
 
-        updates = updates_interp;
+        updates.swap(updates_interp);
 
         if (settings_.activeVerbosity() > 0)
         {
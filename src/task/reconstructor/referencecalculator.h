@@ -21,6 +21,7 @@
 #include "referencecalculatordefs.h"
 #include "referencecalculatorannotations.h"
 #include "test_target.h"
+#include "util/tbbhack.h"
 
 #include <vector>
 
@@ -145,6 +146,16 @@ private:
         Success
     };
 
+    /**
+     * Per-thread scratch memory, reused across targets and slices.
+     * Only valid as long as target reconstruction does not run nested parallel sections.
+     */
+    struct ReconstructionScratch
+    {
+        std::vector<kalman::KalmanUpdate> updates;
+        std::vector<kalman::KalmanUpdate> updates_interp;
+    };
+
     void resetDataStructs();
     void updateInterpOptions();
 
@@ -191,4 +202,7 @@ private:
 
     std::map<unsigned int, TargetReferences>              references_;
     std::map<unsigned int, reconstruction::InterpOptions> interp_options_;
+
+    tbb::enumerable_thread_specific<ReconstructionScratch> scratch_;
+    Measurements                                           line_measurements_; // reused during measurement generation
 };
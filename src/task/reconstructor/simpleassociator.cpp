@@ -254,6 +254,11 @@ bool SimpleAssociator::isTargetAccuracyAcceptable(
     return true;
 }
 
+boost::optional<double> SimpleAssociator::maxAssociationDistance()
+{
+    return reconstructor_.settings().max_distance_acceptable_; // score only accepts smaller distances
+}
+
 // bool SimpleAssociator::isTargetAverageDistanceAcceptable(double distance_score_avg, bool secondary_verified)
 // {
 //     return distance_score_avg < reconstructor_.settings().max_distance_acceptable_;
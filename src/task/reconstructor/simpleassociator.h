@@ -54,6 +54,8 @@ private:
 
     virtual bool isTargetAccuracyAcceptable(
         double tgt_est_std_dev, unsigned int utn, const dbContent::targetReport::ReconstructorInfo& tr, bool do_debug) override;
+
+    virtual boost::optional<double> maxAssociationDistance() override;
     //virtual bool isTargetAverageDistanceAcceptable(double distance_score_avg, bool secondary_verified) override;
 
     virtual ReconstructorBase& reconstructor() override;
@@ -0,0 +1,194 @@
+/*
+ * This file is part of OpenATS COMPASS.
+ *
+ * COMPASS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * COMPASS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with COMPASS. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "targetpositionindex.h"
+#include "timeconv.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace
+{
+    // smaller than any earth radius used in distance computations, to keep bounds conservative
+    const double EarthRadiusMin = 6350000.0;
+    const double DistanceMargin = 1.01;
+    const double DegMargin      = 1E-6;
+
+    // boxes covering more cells are not registered in the grid, but always returned
+    const size_t MaxBoxCells    = 64;
+}
+
+/**
+ * Grid cells are chosen to be about twice the search radius, so that a query covers few cells.
+ */
+void TargetPositionIndex::configure(double max_distance_m, const boost::posix_time::time_duration& max_time_diff)
+{
+    assert (max_distance_m > 0);
+
+    max_distance_m_ = max_distance_m;
+    max_time_diff_  = max_time_diff;
+
+    cell_size_deg_  = std::max(2.0 * max_distance_m_ * DistanceMargin / EarthRadiusMin * 180.0 / M_PI, 1E-4);
+    // round up, buckets must not be shorter than the max time difference
+    long max_time_diff_ms = (long)std::ceil(max_time_diff_.total_microseconds() / 1000.0);
+    time_bucket_ms_ = std::max(max_time_diff_ms, (long)1000);
+
+    clear();
+}
+
+void TargetPositionIndex::clear()
+{
+    boxes_.clear();
+    cells_.clear();
+    unbounded_.clear();
+}
+
+long TargetPositionIndex::timeBucket(const boost::posix_time::ptime& timestamp) const
+{
+    long t = Utils::Time::toLong(timestamp);
+
+    // floor division, also for negative values
+    return t >= 0 ? t / time_bucket_ms_ : -((-t - 1) / time_bucket_ms_) - 1;
+}
+
+int TargetPositionIndex::cell(double value_deg) const
+{
+    return (int) std::floor(value_deg / cell_size_deg_);
+}
+
+/**
+ * Positions interpolated for a timestamp use target reports within the maximum time difference,
+ * which are in the same or the neighbouring time buckets, so the position is added to all three.
+ */
+void TargetPositionIndex::add(unsigned int utn, const boost::posix_time::ptime& timestamp,
+                              double latitude, double longitude)
+{
+    long time_bucket = timeBucket(timestamp);
+
+    int lat_cell = cell(latitude);
+    int lon_cell = cell(longitude);
+
+    for (long bucket = time_bucket - 1; bucket <= time_bucket + 1; ++bucket)
+        addToBucket(utn, bucket, lat_cell, lon_cell);
+}
+
+void TargetPositionIndex::addToBucket(unsigned int utn, long time_bucket, int lat_cell, int lon_cell)
+{
+    CellBox& box = boxes_[{utn, time_bucket}];
+
+    if (box.contains(lat_cell, lon_cell)) // nothing new covered
+        return;
+
+    CellBox old_box = box;
+
+    if (box.empty())
+    {
+        box.lat_cell_min_ = box.lat_cell_max_ = lat_cell;
+        box.lon_cell_min_ = box.lon_cell_max_ = lon_cell;
+    }
+    else
+    {
+        box.lat_cell_min_ = std::min(box.lat_cell_min_, lat_cell);
+        box.lat_cell_max_ = std::max(box.lat_cell_max_, lat_cell);
+        box.lon_cell_min_ = std::min(box.lon_cell_min_, lon_cell);
+        box.lon_cell_max_ = std::max(box.lon_cell_max_, lon_cell);
+    }
+
+    if (old_box.numCells() > MaxBoxCells) // already unbounded
+        return;
+
+    if (box.numCells() > MaxBoxCells)
+    {
+        unbounded_[time_bucket].push_back(utn);
+        return;
+    }
+
+    // register in newly covered cells only
+    CellKey key;
+    key.time_bucket_ = time_bucket;
+
+    for (key.lat_cell_ = box.lat_cell_min_; key.lat_cell_ <= box.lat_cell_max_; ++key.lat_cell_)
+    {
+        for (key.lon_cell_ = box.lon_cell_min_; key.lon_cell_ <= box.lon_cell_max_; ++key.lon_cell_)
+        {
+            if (!old_box.contains(key.lat_cell_, key.lon_cell_))
+                cells_[key].push_back(utn);
+        }
+    }
+}
+
+bool TargetPositionIndex::query(std::vector<unsigned int>& utns, const boost::posix_time::ptime& timestamp,
+                                double latitude, double longitude) const
+{
+    utns.clear();
+
+    assert (max_distance_m_ > 0);
+
+    double angle = max_distance_m_ * DistanceMargin / EarthRadiusMin; // rad
+
+    // haversine: distance >= radius * delta lat
+    double d_lat = angle * 180.0 / M_PI + DegMargin;
+
+    double lat_min = latitude - d_lat;
+    double lat_max = latitude + d_lat;
+
+    if (lat_min <= -90.0 || lat_max >= 90.0)
+        return false;
+
+    // haversine: sin(d/2R) >= cos(lat1) * cos(lat2) * sin(delta long/2), bounded by the minimum cos in the box
+    double cos_min = std::cos(std::max(std::fabs(lat_min), std::fabs(lat_max)) * M_PI / 180.0);
+    double sin_d_lon = std::sin(angle / 2.0) / cos_min;
+
+    if (sin_d_lon >= 1.0)
+        return false;
+
+    double d_lon = 2.0 * std::asin(sin_d_lon) * 180.0 / M_PI + DegMargin;
+
+    double lon_min = longitude - d_lon;
+    double lon_max = longitude + d_lon;
+
+    if (lon_min <= -180.0 || lon_max >= 180.0)
+        return false;
+
+    CellKey key;
+    key.time_bucket_ = timeBucket(timestamp);
+
+    int lat_cell_max = cell(lat_max);
+    int lon_cell_max = cell(lon_max);
+
+    for (key.lat_cell_ = cell(lat_min); key.lat_cell_ <= lat_cell_max; ++key.lat_cell_)
+    {
+        for (key.lon_cell_ = cell(lon_min); key.lon_cell_ <= lon_cell_max; ++key.lon_cell_)
+        {
+            auto it = cells_.find(key);
+
+            if (it != cells_.end())
+                utns.insert(utns.end(), it->second.begin(), it->second.end());
+        }
+    }
+
+    auto unbounded_it = unbounded_.find(key.time_bucket_);
+
+    if (unbounded_it != unbounded_.end())
+        utns.insert(utns.end(), unbounded_it->second.begin(), unbounded_it->second.end());
+
+    std::sort(utns.begin(), utns.end());
+    utns.erase(std::unique(utns.begin(), utns.end()), utns.end());
+
+    return true;
+}
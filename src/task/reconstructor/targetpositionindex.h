@@ -0,0 +1,117 @@
+/*
+ * This file is part of OpenATS COMPASS.
+ *
+ * COMPASS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * COMPASS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with COMPASS. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Spatial-temporal grid over the target report positions of reconstructor targets, used to find
+ * association candidates for a target report without checking all targets.
+ *
+ * Time is split into buckets of at least the maximum time difference. For each target and bucket the
+ * lat/long bounding box of all target report positions in the bucket and its neighbours is kept, so it
+ * encloses every position interpolated from target reports within the maximum time difference of a
+ * timestamp in the bucket. The boxes are registered in a lat/long grid per bucket.
+ *
+ * A query returns all utns whose box intersects a lat/long box conservatively enclosing all positions within
+ * the maximum distance, i.e. a superset of the targets which could be within the maximum distance.
+ *
+ * Entries are only added, removed targets have to be filtered by the caller or the index rebuilt.
+ */
+class TargetPositionIndex
+{
+public:
+    TargetPositionIndex() = default;
+    virtual ~TargetPositionIndex() = default;
+
+    // sets grid sizes and clears
+    void configure(double max_distance_m, const boost::posix_time::time_duration& max_time_diff);
+    void clear();
+
+    void add(unsigned int utn, const boost::posix_time::ptime& timestamp, double latitude, double longitude);
+
+    // collects sorted unique candidate utns, returns false if the position can not be bounded
+    // (close to poles or date line), then all targets have to be checked
+    bool query(std::vector<unsigned int>& utns, const boost::posix_time::ptime& timestamp,
+               double latitude, double longitude) const;
+
+    double maxDistance() const { return max_distance_m_; }
+    const boost::posix_time::time_duration& maxTimeDiff() const { return max_time_diff_; }
+    size_t numCells() const { return cells_.size(); }
+
+private:
+    struct CellKey
+    {
+        long time_bucket_ {0};
+        int  lat_cell_ {0};
+        int  lon_cell_ {0};
+
+        bool operator==(const CellKey& other) const
+        {
+            return time_bucket_ == other.time_bucket_ && lat_cell_ == other.lat_cell_ && lon_cell_ == other.lon_cell_;
+        }
+    };
+
+    struct CellKeyHash
+    {
+        size_t operator()(const CellKey& key) const
+        {
+            size_t h = std::hash<long>()(key.time_bucket_);
+            h = h * 31 + std::hash<int>()(key.lat_cell_);
+            h = h * 31 + std::hash<int>()(key.lon_cell_);
+            return h;
+        }
+    };
+
+    struct CellBox
+    {
+        int lat_cell_min_ {0};
+        int lat_cell_max_ {-1};
+        int lon_cell_min_ {0};
+        int lon_cell_max_ {-1};
+
+        bool empty() const { return lat_cell_max_ < lat_cell_min_; }
+        bool contains(int lat_cell, int lon_cell) const
+        {
+            return lat_cell >= lat_cell_min_ && lat_cell <= lat_cell_max_
+                   && lon_cell >= lon_cell_min_ && lon_cell <= lon_cell_max_;
+        }
+        size_t numCells() const
+        {
+            return empty() ? 0 : (size_t)(lat_cell_max_ - lat_cell_min_ + 1) * (lon_cell_max_ - lon_cell_min_ + 1);
+        }
+    };
+
+    long timeBucket(const boost::posix_time::ptime& timestamp) const;
+    int cell(double value_deg) const;
+    void addToBucket(unsigned int utn, long time_bucket, int lat_cell, int lon_cell);
+
+    double max_distance_m_ {0};
+    boost::posix_time::time_duration max_time_diff_;
+
+    double cell_size_deg_ {1.0};
+    long   time_bucket_ms_ {1000};
+
+    std::map<std::pair<unsigned int, long>, CellBox> boxes_; // (utn, time bucket) -> box in grid cells
+    std::unordered_map<CellKey, std::vector<unsigned int>, CellKeyHash> cells_;
+    std::map<long, std::vector<unsigned int>> unbounded_; // time bucket -> utns with too large boxes
+};
@@ -31,6 +31,7 @@
 #include "viewmanager.h"
 #include "dbinterface.h"
 #include "asynctask.h"
+#include "benchmark_commands.h"
 
 #include "asteriximporttask.h"
 #include "asteriximporttaskwidget.h"
@@ -66,6 +67,8 @@ TaskManager::TaskManager(const std::string& class_id, const std::string& instanc
     createSubConfigurables();
 
     setObjectName("TaskManager");
+
+    init_benchmark_commands();
 }
 
 /**
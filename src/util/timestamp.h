@@ -0,0 +1,94 @@
+/*
+ * This file is part of OpenATS COMPASS.
+ *
+ * COMPASS is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * COMPASS is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with COMPASS. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "boost/date_time/posix_time/posix_time.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace Utils
+{
+namespace Time
+{
+
+/**
+ * Point in time as integer microseconds since epoch (1970-01-01 00:00:00).
+ *
+ * Trivially copyable replacement for boost::posix_time::ptime as key in large lookup containers,
+ * for which comparisons and differences reduce to plain integer operations. Conversion from and to
+ * ptime should only happen at interface boundaries (e.g. when inserting into a lookup or for display).
+ *
+ * Currently used as key of the reconstructor's time lookups and as search key of the target report
+ * chain index. Buffer columns and the EvaluationTargetData interfaces (data mappings, DataID) still use ptime.
+ */
+class Timestamp
+{
+public:
+    Timestamp() = default;
+    explicit Timestamp(int64_t microseconds) : us_(microseconds) {}
+    explicit Timestamp(const boost::posix_time::ptime& value)
+    :   us_(value.is_special() ? InvalidValue : (value - epoch()).total_microseconds()) {}
+
+    bool valid() const { return us_ != InvalidValue; }
+    int64_t microseconds() const { return us_; }
+
+    boost::posix_time::ptime toPTime() const
+    {
+        if (!valid())
+            return {};
+
+        return epoch() + boost::posix_time::microseconds(us_);
+    }
+
+    bool operator==(const Timestamp& other) const { return us_ == other.us_; }
+    bool operator!=(const Timestamp& other) const { return us_ != other.us_; }
+    bool operator< (const Timestamp& other) const { return us_ <  other.us_; }
+    bool operator<=(const Timestamp& other) const { return us_ <= other.us_; }
+    bool operator> (const Timestamp& other) const { return us_ >  other.us_; }
+    bool operator>=(const Timestamp& other) const { return us_ >= other.us_; }
+
+    // difference in microseconds
+    int64_t operator-(const Timestamp& other) const { return us_ - other.us_; }
+
+    Timestamp operator+(int64_t microseconds) const { return Timestamp(us_ + microseconds); }
+    Timestamp operator-(int64_t microseconds) const { return Timestamp(us_ - microseconds); }
+
+    static int64_t microseconds(const boost::posix_time::time_duration& duration)
+    {
+        return duration.total_microseconds();
+    }
+
+private:
+    static const int64_t InvalidValue = std::numeric_limits<int64_t>::min();
+
+    static const boost::posix_time::ptime& epoch()
+    {
+        static const boost::posix_time::ptime epoch_time(boost::gregorian::date(1970, 1, 1));
+        return epoch_time;
+    }
+
+    int64_t us_ = InvalidValue;
+};
+
+static_assert(std::is_trivially_copyable<Timestamp>::value, "Timestamp must be trivially copyable");
+
+}  // namespace Time
+
+}  // namespace Utils